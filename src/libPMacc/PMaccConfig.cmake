@@ -78,6 +78,27 @@ IF(PMACC_BLOCKING_KERNEL)
     LIST(APPEND _PMACC_COMPILE_DEFINITIONS_PUBLIC "PMACC_SYNC_KERNEL=1")
 ENDIF(PMACC_BLOCKING_KERNEL)
 
+OPTION(PMACC_CPU_ASYNC_STREAM "Use asynchronous streams for CPU accelerators (kernels are executed by stream worker threads)" OFF)
+IF(PMACC_CPU_ASYNC_STREAM)
+    LIST(APPEND _PMACC_COMPILE_DEFINITIONS_PUBLIC "PMACC_CPU_ASYNC_STREAM=1")
+ENDIF(PMACC_CPU_ASYNC_STREAM)
+
+OPTION(PMACC_CPU_SUPERCELL_PER_THREAD "Process a whole supercell by one CPU thread in particle kernels (OpenMP over supercells)" OFF)
+IF(PMACC_CPU_SUPERCELL_PER_THREAD)
+    SET(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE ON CACHE BOOL "Enable the OpenMP 2.0 CPU block accelerator" FORCE)
+    LIST(APPEND _PMACC_COMPILE_DEFINITIONS_PUBLIC "PMACC_CPU_SUPERCELL_PER_THREAD=1")
+ENDIF(PMACC_CPU_SUPERCELL_PER_THREAD)
+
+OPTION(PMACC_SHIFT_PREFIX_SUM "Shift particles between supercells with a per direction prefix sum instead of atomic counters" OFF)
+IF(PMACC_SHIFT_PREFIX_SUM)
+    LIST(APPEND _PMACC_COMPILE_DEFINITIONS_PUBLIC "PMACC_SHIFT_PREFIX_SUM=1")
+ENDIF(PMACC_SHIFT_PREFIX_SUM)
+
+OPTION(PMACC_CPU_FIRST_TOUCH "Pin OpenMP threads and initialize CPU device buffers with all threads (NUMA first touch)" OFF)
+IF(PMACC_CPU_FIRST_TOUCH)
+    LIST(APPEND _PMACC_COMPILE_DEFINITIONS_PUBLIC "PMACC_CPU_FIRST_TOUCH=1")
+ENDIF(PMACC_CPU_FIRST_TOUCH)
+
 #-------------------------------------------------------------------------------
 # Find alpaka
 # NOTE: Do this first, because it declares `list_add_prefix` and `append_recursive_files_add_to_src_group` used later on.
@@ -102,6 +102,7 @@ namespace PMacc
 #include "dataManagement/DataConnector.hpp"
 #include "pluginSystem/PluginConnector.hpp"
 #include "nvidia/memory/MemoryInfo.hpp"
+#include "memory/NumaPlacement.hpp"
 #include "mappings/simulation/Filesystem.hpp"
 
 
@@ -196,6 +197,8 @@ public:
 
         PMacc::DeviceManager::getInstance().init(static_cast<std::size_t>(PMacc::GridController<DIM>::getInstance().getHostRank()));
 
+        PMacc::NumaPlacement::getInstance().pinThreads();
+
         PMacc::StreamController::getInstance().activate(PMacc::DeviceManager::getInstance().getAccDevice());
 
         nvidia::memory::MemoryInfo::getInstance().activate(PMacc::DeviceManager::getInstance().getAccDevice());
@@ -235,6 +238,7 @@ private:
 
 #define __startTransaction(...) (PMacc::Environment<>::get().TransactionManager().startTransaction(__VA_ARGS__))
 #define __startAtomicTransaction(...) (PMacc::Environment<>::get().TransactionManager().startAtomicTransaction(__VA_ARGS__))
+#define __startStreamTransaction(event, stream) (PMacc::Environment<>::get().TransactionManager().startStreamTransaction((event), (stream)))
 #define __endTransaction() (PMacc::Environment<>::get().TransactionManager().endTransaction())
 #define __startOperation(opType) (PMacc::Environment<>::get().TransactionManager().startOperation(opType))
 #define __getTransactionEvent() (PMacc::Environment<>::get().TransactionManager().getTransactionEvent())
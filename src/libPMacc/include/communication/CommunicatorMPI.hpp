@@ -153,10 +153,8 @@ public:
 
     // description in ICommunicator
 
-    MPI_Request* startSend(uint32_t ex, const char *send_data, size_t send_data_count, uint32_t tag)
+    void startSend(uint32_t ex, const char *send_data, size_t send_data_count, uint32_t tag, MPI_Request *request)
     {
-        MPI_Request *request = new MPI_Request;
-
         MPI_CHECK(MPI_Isend(
                             (void*) send_data,
                             static_cast<int>(send_data_count),
@@ -165,17 +163,12 @@ public:
                             gridExchangeTag + tag,
                             topology,
                             request));
-
-        return request;
     }
 
     // description in ICommunicator
 
-    MPI_Request* startReceive(uint32_t ex, char *recv_data, size_t recv_data_max, uint32_t tag)
+    void startReceive(uint32_t ex, char *recv_data, size_t recv_data_max, uint32_t tag, MPI_Request *request)
     {
-
-        MPI_Request *request = new MPI_Request;
-
         MPI_CHECK(MPI_Irecv(
                             recv_data,
                             static_cast<int>(recv_data_max),
@@ -184,8 +177,13 @@ public:
                             gridExchangeTag + tag,
                             topology,
                             request));
+    }
+
+    // description in ICommunicator
 
-        return request;
+    int getNeighborRank(uint32_t ex)
+    {
+        return ExchangeTypeToRank(ex);
     }
 
     // description in ICommunicator
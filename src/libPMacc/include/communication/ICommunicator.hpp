@@ -59,9 +59,9 @@ public:
      * \param[in] send_data         pointer to data; should have at least send_data_count bytes
      * \param[in] send_data_count   message size in bytes to sent
      * \param[in] tag               user-defined tag; only message with the same tag can be exchanged (i.e. startSend and startReceive must use the same tag)
-     * \returns an request for testing if this operation has already finished
+     * \param[out] request          request for testing if this operation has already finished (owned by the caller)
      */
-    virtual MPI_Request* startSend(uint32_t ex, const char *send_data, size_t send_data_count, uint32_t tag) = 0;
+    virtual void startSend(uint32_t ex, const char *send_data, size_t send_data_count, uint32_t tag, MPI_Request *request) = 0;
 
     /*! starts receiving via MPI (non-blocking)
      *
@@ -71,12 +71,17 @@ public:
      * \param[in] recv_data         pointer to data; should have at least recv_data_max bytes
      * \param[in] recv_data_max     maximum message size in bytes to receive
      * \param[in] tag               user-defined tag; only message with the same tag can be exchanged (i.e. startSend and startReceive must use the same tag)
-     * \returns an request for testing if this operation has already finished
+     * \param[out] request          request for testing if this operation has already finished (owned by the caller)
      */
-    virtual MPI_Request* startReceive(uint32_t ex, char *recv_data, size_t recv_data_max, uint32_t tag) = 0;
+    virtual void startReceive(uint32_t ex, char *recv_data, size_t recv_data_max, uint32_t tag, MPI_Request *request) = 0;
 
     virtual int getRank()=0;
 
+    /*! returns the rank of the neighbor in direction ex
+     * \param[in] ex                direction (enum ExchangeType)
+     */
+    virtual int getNeighborRank(uint32_t ex)=0;
+
 };
 
 } //namespace PMacc
@@ -28,6 +28,7 @@
 #include "math/vector/Int.hpp"
 #include "lambda/make_Functor.hpp"
 #include "detail/SphericMapper.hpp"
+#include "detail/ForeachKernel.hpp"
 #include "forward.hpp"
 
 #include <boost/preprocessor/repetition/enum.hpp>
@@ -51,30 +52,6 @@ namespace kernel
 #define FOREACH_KERNEL_MAX_PARAMS 4
 #endif
 
-namespace detail
-{
-
-#define SHIFTACCESS_CURSOR(Z, N, _) forward(c ## N [cellIndex])
-
-#define KERNEL_FOREACH(Z, N, _)                                                                             \
-                        /* typename C0, typename C1, ... */                                                 \
-template<typename Mapper, BOOST_PP_ENUM_PARAMS(N, typename C), typename Functor>                            \
-                                                /* C0 c0, C1 c1, ... */                                     \
-__global__ void kernelForeachBlock(Mapper mapper,Functor functor, BOOST_PP_ENUM_BINARY_PARAMS(N, C, c))     \
-{                                                                                                           \
-    DataSpace<Mapper::dim> const blockIndex(alpaka::idx::getIdx<alpaka::Grid, alpaka::Blocks>(acc));        \
-    math::Int<Mapper::dim> cellIndex(mapper(blockIndex));                                                   \
-         /* c0[cellIndex], c1[cellIndex], ... */                                                            \
-    functor(BOOST_PP_ENUM(N, SHIFTACCESS_CURSOR, _));                                                       \
-}
-
-BOOST_PP_REPEAT_FROM_TO(1, BOOST_PP_INC(FOREACH_KERNEL_MAX_PARAMS), KERNEL_FOREACH, _)
-
-#undef KERNEL_FOREACH
-#undef SHIFTACCESS_CURSOR
-
-}
-
 #define SHIFT_CURSOR_ZONE(Z, N, _) C ## N c ## N ## _shifted = c ## N (p_zone.offset);
 #define SHIFTED_CURSOR(Z, N, _) c ## N ## _shifted
 
@@ -113,9 +90,9 @@ struct ForeachBlock
      *
      * \param zone Accepts currently only a zone::SphericZone object (e.g. containerObj.zone())
      * \param cursorN cursor for the N-th data source (e.g. containerObj.origin())
-     * \param functor or lambdaFun either a functor with N arguments or a N-ary lambda function (e.g. _1 = _2)
+     * \param functor a functor with the accelerator and N cursors as arguments
      *
-     * It is called like functor(*cursor0(cellId), ..., *cursorN(cellId))
+     * It is called like functor(acc, cursor0(blockCellId), ..., cursorN(blockCellId))
      *
      */
     BOOST_PP_REPEAT_FROM_TO(1, BOOST_PP_INC(FOREACH_KERNEL_MAX_PARAMS), FOREACH_OPERATOR, _)
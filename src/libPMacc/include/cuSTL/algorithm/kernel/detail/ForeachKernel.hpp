@@ -24,6 +24,7 @@
 
 #include <math/vector/Int.hpp>  // math::Int
 #include "types.h"
+#include "dimensions/DataSpace.hpp"
 
 #include <utility>              // std::forward
 
@@ -61,6 +62,36 @@ namespace detail
         }
     };
 
+    /** Kernel of ForeachBlock
+     *
+     * Every thread of a block gets the cursors shifted to the first cell of
+     * its block. The accelerator is passed on to the functor so that it can
+     * synchronize the threads of the block.
+     */
+    class kernelForeachBlock
+    {
+    public:
+        //-----------------------------------------------------------------------------
+        //! The kernel.
+        //-----------------------------------------------------------------------------
+        template<
+            typename T_Acc,
+            typename TMapper,
+            typename TFunctor,
+            typename... TC>
+        ALPAKA_FN_ACC void operator()(
+            T_Acc const & acc,
+            TMapper const & mapper,
+            TFunctor const & functor,
+            TC && ... c) const
+        {
+            DataSpace<TMapper::dim> const blockIndex(alpaka::idx::getIdx<alpaka::Grid, alpaka::Blocks>(acc));
+            math::Int<TMapper::dim> cellIndex(mapper(blockIndex, DataSpace<TMapper::dim>()));
+
+            functor(acc, c[cellIndex]...);
+        }
+    };
+
 } // namespace detail
 } // namespace kernel
 } // namespace algorithm
@@ -24,24 +24,67 @@
 #pragma once
 
 #include "eventSystem/tasks/ITask.hpp"
+#include "eventSystem/tasks/TaskPool.hpp"
+
+#include <mpi.h>
 
 #include <map>
 #include <set>
+#include <deque>
+#include <vector>
 
 namespace PMacc
 {
     // forward declaration
     class EventTask;
     class EventPool;
+    class MPITask;
 
     /**
      * Manages the event system by executing and waiting for tasks.
+     *
+     * Active tasks are scheduled with a dependency counted ready queue:
+     * - a task which is registered as observer of a new task
+     *   (registeringTask in the Factory) is not polled until all of these
+     *   prerequisites are finished
+     * - tasks which wrap a single MPI request are not polled one by one,
+     *   their requests are tested together with MPI_Testsome
+     * - all other tasks are polled round robin
      */
     class Manager : public IEvent
     {
     public:
-        typedef std::map<id_t, ITask*> TaskMap;
-        typedef std::set<id_t> TaskSet;
+        /* all containers take their nodes from the TaskPool */
+        typedef std::map<id_t, ITask*, std::less<id_t>,
+            TaskPoolAllocator<std::pair<const id_t, ITask*> > > TaskMap;
+        typedef std::set<id_t, std::less<id_t>, TaskPoolAllocator<id_t> > TaskSet;
+        typedef std::deque<id_t, TaskPoolAllocator<id_t> > TaskQueue;
+        typedef std::map<id_t, uint32_t, std::less<id_t>,
+            TaskPoolAllocator<std::pair<const id_t, uint32_t> > > CounterMap;
+        typedef std::multimap<id_t, id_t, std::less<id_t>,
+            TaskPoolAllocator<std::pair<const id_t, id_t> > > DependencyMap;
+        typedef std::map<id_t, MPITask*, std::less<id_t>,
+            TaskPoolAllocator<std::pair<const id_t, MPITask*> > > MPITaskMap;
+
+        /**
+         * Counters for the work done by the scheduler since the last reset.
+         */
+        struct Statistics
+        {
+            /* number of calls to Manager::execute() */
+            uint64_t sweeps;
+            /* number of ITask::execute() calls */
+            uint64_t taskPolls;
+            /* number of MPI_Testsome() calls */
+            uint64_t mpiTests;
+            /* number of finished active tasks */
+            uint64_t finishedTasks;
+
+            Statistics() :
+            sweeps(0), taskPolls(0), mpiTests(0), finishedTasks(0)
+            {
+            }
+        };
 
         bool execute(id_t taskToWait = 0);
 
@@ -72,10 +115,27 @@ namespace PMacc
 
         void addPassiveTask(ITask *task);
 
+        /**
+         * Do not poll a task until another task is finished.
+         *
+         * The task can be added to the manager before or after this call.
+         *
+         * @param taskId id of the task which waits
+         * @param prerequisiteId id of the task which must be finished first
+         */
+        void addDependency(id_t taskId, id_t prerequisiteId);
+
         EventPool& getEventPool();
 
         std::size_t getCount();
 
+        /**
+         * Get the scheduler counters since the last call of resetStatistics()
+         */
+        const Statistics& getStatistics() const;
+
+        void resetStatistics();
+
     private:
 
         friend class Environment<DIM1>;
@@ -86,6 +146,33 @@ namespace PMacc
 
         inline ITask* getActiveITaskIfNotFinished(id_t taskId) const;
 
+        /**
+         * give the CPU to stream worker threads while the host is waiting
+         *
+         * no-op if PMACC_CPU_ASYNC_STREAM is disabled
+         */
+        inline void yieldToStreams();
+
+        /**
+         * add a task to the end of the ready queue if it is not already queued
+         */
+        inline void enqueue(id_t taskId);
+
+        inline bool isBlocked(id_t taskId) const;
+
+        /**
+         * remove a finished task, delete it and release all tasks which
+         * depend on it
+         */
+        void finishTask(id_t taskId, ITask* taskPtr);
+
+        /**
+         * test all pending MPI requests at once and finish the completed tasks
+         *
+         * @return true if taskToWait is finished
+         */
+        bool testMPIRequests(id_t taskToWait);
+
         Manager();
 
         Manager(const Manager& cc);
@@ -98,8 +185,29 @@ namespace PMacc
             return instance;
         }
 
+        /* all active tasks */
         TaskMap tasks;
         TaskMap passiveTasks;
+
+        /* active tasks without unfinished prerequisites */
+        TaskQueue readyQueue;
+        TaskSet queuedTasks;
+
+        /* number of unfinished prerequisites of a task */
+        CounterMap pendingDependencies;
+        /* prerequisite id -> ids of the waiting tasks */
+        DependencyMap dependentTasks;
+
+        /* active tasks wrapping a single MPI request */
+        MPITaskMap mpiTasks;
+        /* buffers for MPI_Testsome, kept to avoid allocations while polling */
+        std::vector<MPI_Request> mpiRequestBuffer;
+        std::vector<id_t> mpiTaskIdBuffer;
+        std::vector<int> mpiIndexBuffer;
+        std::vector<MPI_Status> mpiStatusBuffer;
+
+        Statistics statistics;
+
         std::unique_ptr<EventPool> eventPool;
     };
 
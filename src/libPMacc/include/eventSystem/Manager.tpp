@@ -22,15 +22,16 @@
 
 #include "eventSystem/events/EventPool.hpp"
 #include "eventSystem/streams/StreamController.hpp"
+#include "eventSystem/tasks/MPITask.hpp"
 #include "eventSystem/EventSystem.hpp"
 #include "eventSystem/Manager.hpp"
+#include "communication/manager_common.h"
 
 #include <cstdlib>
 #include <cstdio>
 #include <set>
 #include <iostream>
-
-//#define DEBUG_EVENTS
+#include <thread>
 
 namespace PMacc
 {
@@ -43,65 +44,135 @@ inline Manager::~Manager( )
 
 inline bool Manager::execute( id_t taskToWait )
 {
-#ifdef DEBUG_EVENTS
-    static int old_max = 0;
-    static int deep = -1;
-        static int counter = 0;
-    ++counter;
+    ++statistics.sweeps;
 
-    deep++;
-    if ( deep > old_max )
-    {
-        old_max = deep;
-    }
-#endif
+    if ( testMPIRequests( taskToWait ) )
+        return true;
 
-    static TaskMap::iterator iter = tasks.begin( );
+    /* poll each task which is queued at the begin of this sweep once,
+     * tasks finished by a deeper stack level are skipped
+     */
+    size_t numQueued = readyQueue.size( );
+    while ( numQueued != 0 && !readyQueue.empty( ) )
+    {
+        --numQueued;
+        id_t id = readyQueue.front( );
+        readyQueue.pop_front( );
+        queuedTasks.erase( id );
 
-    if ( iter == tasks.end( ) )
-        iter = tasks.begin( );
+        ITask* taskPtr = getActiveITaskIfNotFinished( id );
+        /* blocked tasks are queued again if their prerequisites are finished */
+        if ( taskPtr == NULL || isBlocked( id ) )
+            continue;
 
-    // this is the slow but very save variant to delete tasks in a map
-    while ( iter != tasks.end( ) )
-    {
-        id_t id = iter->first;
-        ITask* taskPtr = iter->second;
-        assert( taskPtr != NULL );
-        ++iter;
-#ifdef DEBUG_EVENTS
-        if ( counter == 500000 )
-            std::cout << taskPtr->toString( ) << " " << passiveTasks.size( ) << std::endl;
-#endif
+        ++statistics.taskPolls;
         if ( taskPtr->execute( ) )
         {
             /*test if task is deleted by other stackdeep*/
             if ( getActiveITaskIfNotFinished( id ) == taskPtr )
-            {
-                tasks.erase( id );
-                __delete(taskPtr);
-            }
-#ifdef DEBUG_EVENTS
-            counter = 0;
-#endif
+                finishTask( id, taskPtr );
 
             if ( taskToWait == id )
-            {
-                iter = tasks.end( );
-#ifdef DEBUG_EVENTS
-                --deep;
-#endif
                 return true; //jump out because searched task is finished
-            }
         }
+        else if ( getActiveITaskIfNotFinished( id ) == taskPtr )
+            enqueue( id );
     }
 
-#ifdef DEBUG_EVENTS
-    --deep;
-#endif
-
     return false;
 }
 
+inline bool Manager::testMPIRequests( id_t taskToWait )
+{
+    if ( mpiTasks.empty( ) )
+        return false;
+
+    mpiRequestBuffer.clear( );
+    mpiTaskIdBuffer.clear( );
+    for ( MPITaskMap::const_iterator it = mpiTasks.begin( ); it != mpiTasks.end( ); ++it )
+    {
+        mpiRequestBuffer.push_back( *( it->second->getMPIRequest( ) ) );
+        mpiTaskIdBuffer.push_back( it->first );
+    }
+    const int numRequests = static_cast<int>( mpiRequestBuffer.size( ) );
+    mpiIndexBuffer.resize( numRequests );
+    mpiStatusBuffer.resize( numRequests );
+
+    int numCompleted = 0;
+    ++statistics.mpiTests;
+    MPI_CHECK( MPI_Testsome( numRequests, &( mpiRequestBuffer[0] ), &numCompleted,
+                             &( mpiIndexBuffer[0] ), &( mpiStatusBuffer[0] ) ) );
+
+    if ( numCompleted == MPI_UNDEFINED || numCompleted == 0 )
+        return false;
+
+    /* MPI has freed the completed requests: hand over the status and remove
+     * the tasks from the MPI set before any observer is notified, a deeper
+     * stack level must not test these requests again
+     */
+    std::vector<id_t> completed( numCompleted );
+    for ( int i = 0; i < numCompleted; ++i )
+    {
+        const id_t id = mpiTaskIdBuffer[mpiIndexBuffer[i]];
+        mpiTasks[id]->setMPIRequestFinished( mpiStatusBuffer[i] );
+        mpiTasks.erase( id );
+        completed[i] = id;
+    }
+
+    bool foundTaskToWait = false;
+    for ( int i = 0; i < numCompleted; ++i )
+    {
+        ITask* taskPtr = getActiveITaskIfNotFinished( completed[i] );
+        if ( taskPtr != NULL )
+            finishTask( completed[i], taskPtr );
+        if ( completed[i] == taskToWait )
+            foundTaskToWait = true;
+    }
+    return foundTaskToWait;
+}
+
+inline void Manager::finishTask( id_t taskId, ITask* taskPtr )
+{
+    tasks.erase( taskId );
+    ++statistics.finishedTasks;
+    /* the destructor notifies all observers */
+    __delete(taskPtr);
+
+    std::pair<DependencyMap::iterator, DependencyMap::iterator> range =
+        dependentTasks.equal_range( taskId );
+    for ( DependencyMap::iterator it = range.first; it != range.second; ++it )
+    {
+        CounterMap::iterator pending = pendingDependencies.find( it->second );
+        if ( pending == pendingDependencies.end( ) )
+            continue;
+        if ( --( pending->second ) == 0 )
+        {
+            pendingDependencies.erase( pending );
+            if ( getActiveITaskIfNotFinished( it->second ) != NULL )
+                enqueue( it->second );
+        }
+    }
+    dependentTasks.erase( taskId );
+}
+
+inline void Manager::enqueue( id_t taskId )
+{
+    if ( queuedTasks.insert( taskId ).second )
+        readyQueue.push_back( taskId );
+}
+
+inline bool Manager::isBlocked( id_t taskId ) const
+{
+    return pendingDependencies.find( taskId ) != pendingDependencies.end( );
+}
+
+inline void Manager::addDependency( id_t taskId, id_t prerequisiteId )
+{
+    /* the prerequisite is a new task which is not finished yet */
+    ++pendingDependencies[taskId];
+    dependentTasks.insert( std::make_pair( prerequisiteId, taskId ) );
+}
+
 inline void Manager::event( id_t eventId, EventType, IEventData* )
 {
     passiveTasks.erase( eventId );
@@ -141,6 +212,7 @@ inline void Manager::waitForFinished( id_t taskId )
         do
         {
             this->execute( );
+            yieldToStreams( );
         }
         while ( getPassiveITaskIfNotFinished( taskId ) != NULL );
 
@@ -155,6 +227,7 @@ inline void Manager::waitForFinished( id_t taskId )
         {
             if ( this->execute( taskId ) )
                 return; //jump out because task is finished
+            yieldToStreams( );
         }
         while ( getActiveITaskIfNotFinished( taskId ) != NULL );
     }
@@ -165,14 +238,38 @@ inline void Manager::waitForAllTasks( )
     while ( tasks.size( ) != 0 || passiveTasks.size( ) != 0 )
     {
         this->execute( );
+        yieldToStreams( );
     }
     assert( tasks.size( ) == 0 );
 }
 
+inline void Manager::yieldToStreams( )
+{
+#if (PMACC_CPU_ASYNC_STREAM == 1)
+    /* the stream worker threads share the cores with the polling host thread */
+    std::this_thread::yield( );
+#endif
+}
+
 inline void Manager::addTask( ITask *task )
 {
     assert( task != NULL );
-    tasks[task->getId( )] = task;
+    const id_t id = task->getId( );
+    tasks[id] = task;
+
+    if ( task->getTaskType( ) == ITask::TASK_MPI )
+    {
+        /* only MPITasks which wrap a single request are tested via MPI */
+        MPITask* mpiTask = dynamic_cast<MPITask*> ( task );
+        if ( mpiTask != NULL && mpiTask->getMPIRequest( ) != NULL )
+        {
+            mpiTasks[id] = mpiTask;
+            return;
+        }
+    }
+
+    if ( !isBlocked( id ) )
+        enqueue( id );
 }
 
 inline void Manager::addPassiveTask( ITask *task )
@@ -185,6 +282,8 @@ inline void Manager::addPassiveTask( ITask *task )
 
 inline Manager::Manager( )
 {
+    /* the pool must outlive the manager which deletes the last tasks */
+    TaskPool::getInstance( );
     /**
      * The \see Environment ensures that the \see StreamController is
      * already created before calling this
@@ -202,6 +301,16 @@ inline EventPool& Manager::getEventPool( )
     return *eventPool;
 }
 
+inline const Manager::Statistics& Manager::getStatistics( ) const
+{
+    return statistics;
+}
+
+inline void Manager::resetStatistics( )
+{
+    statistics = Statistics( );
+}
+
 inline std::size_t Manager::getCount( )
 {
     for ( TaskMap::iterator iter = tasks.begin( ); iter != tasks.end( ); ++iter )
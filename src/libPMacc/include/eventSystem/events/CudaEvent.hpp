@@ -26,6 +26,8 @@
 #include "types.h"
 #include <alpaka/alpaka.hpp>
 
+#include <memory>
+
 namespace PMacc
 {
 
@@ -48,19 +50,18 @@ public:
 
     /**
      * Copy constructor
+     *
+     * the copy shares the native event, no memory is allocated
      */
-    CudaEvent(CudaEvent const & other) :
-        m_event(
-            new alpaka::event::Event<AlpakaAccStream>(*other.m_event.get())),
-        m_pStream(other.m_pStream),
-        isRecorded(other.isRecorded)
-    {}
+    CudaEvent(CudaEvent const & other) = default;
 
     /**
      * Move constructor
      */
     CudaEvent(CudaEvent && other) = default;
 
+    CudaEvent & operator=(CudaEvent const & other) = default;
+
     /**
      * Destructor
      *
@@ -142,7 +143,7 @@ public:
     }
 
 private:
-    std::unique_ptr<alpaka::event::Event<AlpakaAccStream>> m_event;
+    std::shared_ptr<alpaka::event::Event<AlpakaAccStream>> m_event;
     AlpakaAccStream * m_pStream;
     /* state if event is recorded */
     bool isRecorded;
@@ -24,6 +24,7 @@
 
 #include "dimensions/DataSpace.hpp"
 #include "eventSystem/EventSystem.hpp"
+#include "mappings/threads/ElementMapping.hpp"
 #include "ppFunctions.hpp"
 #include "types.h"
 
@@ -50,12 +51,15 @@
 /** Call activate kernel from taskKernel.
  *  If PMACC_SYNC_KERNEL is 1 cudaDeviceSynchronize() is called before
  *  and after activation.
+ *  If the ProfileRegistry is enabled the kernel is synchronized and timed.
  *
  * activateChecks is used if call is TaskKernel.waitforfinished();
  */
 #define PMACC_ACTIVATE_KERNEL()\
+    taskKernel->startProfiling();\
     ::alpaka::stream::enqueue(taskKernel->getEventStream()->getCudaStream(), exec);\
-    PMACC_KERNEL_CATCH(::alpaka::wait::wait(::PMacc::Environment<>::get().DeviceManager().getAccDevice()), "__cudaKernel: crash after kernel call");\
+    taskKernel->stopProfiling();\
+    PMACC_KERNEL_CATCH(taskKernel->getEventStream()->waitForIdle(), "__cudaKernel: crash after kernel call");\
     taskKernel->activateChecks();\
     PMACC_KERNEL_CATCH(::alpaka::wait::wait(::PMacc::Environment<>::get().DeviceManager().getAccDevice()), "__cudaKernel: crash after kernel activation");\
 
@@ -92,3 +96,26 @@
                 ::PMacc::math::Vector<::PMacc::AlpakaIdxSize,DIM::value>::create(1u)  \
             ), KERNEL                                                          \
         PMACC_KERNEL_PARAMS
+
+/**
+ * Calls a kernel with one thread per cell of a supercell and creates an
+ * EventTask which represents the kernel.
+ *
+ * The kernel is executed with AlpakaSuperCellAcc, the cells of a block are
+ * split into threads and elements by ElementMapping.
+ *
+ * @param KERNEL Instance of the kernel.
+ * @param grid number of blocks
+ * @param block number of cells per block
+ */
+#define __cudaKernelSuperCell(KERNEL, DIM, grid, block)\
+    {\
+        PMACC_KERNEL_CATCH(::alpaka::wait::wait(::PMacc::Environment<>::get().DeviceManager().getAccDevice()), "__cudaKernelSuperCell: crash before kernel call");\
+        ::PMacc::TaskKernel * const taskKernel(::PMacc::Environment<>::get().Factory().createTaskKernel(#KERNEL));\
+        auto const exec(::alpaka::exec::create<::PMacc::AlpakaSuperCellAcc<DIM>>(  \
+            ::alpaka::workdiv::WorkDivMembers<DIM, ::PMacc::AlpakaIdxSize>(    \
+                grid,                                                          \
+                ::PMacc::ElementMapping::getThreadExtent(block),               \
+                ::PMacc::ElementMapping::getElemExtent(block)                  \
+            ), KERNEL                                                          \
+        PMACC_KERNEL_PARAMS
@@ -0,0 +1,233 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#pragma once
+
+#include "types.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace PMacc
+{
+
+    /**
+     * Collects wall times of named sections of a simulation.
+     *
+     * Sections are kernels (identified by the name passed to
+     * createTaskKernel()), MPI send and receive tasks and plugin
+     * notifications. Kernels launched for an area (CORE, BORDER, GUARD) are
+     * additionally accumulated per area.
+     *
+     * Kernels which know their memory traffic report it with addBytes(),
+     * the report shows the achieved bandwidth of these sections.
+     *
+     * If the registry is disabled no time is taken. If it is enabled kernels
+     * are synchronized after each launch to measure their runtime, therefore
+     * the profile changes the overlap of communication and computation.
+     *
+     * This class is a singleton.
+     */
+    class ProfileRegistry
+    {
+    public:
+
+        void setEnabled(bool value)
+        {
+            enabled = value;
+        }
+
+        bool isEnabled() const
+        {
+            return enabled;
+        }
+
+        /**
+         * Add a measurement of a section.
+         *
+         * @param name name of the section
+         * @param area area of the kernel launch or 0 if the section has no area
+         * @param time wall time in milliseconds
+         */
+        void addSample(const std::string& name, uint32_t area, double time)
+        {
+            if (!enabled)
+                return;
+            Section& section = sections[name];
+            section.total.add(time);
+            if (area != 0)
+                section.areas[area].add(time);
+        }
+
+        /**
+         * Add the memory traffic of a call of a section.
+         *
+         * @param name name of the section
+         * @param bytes bytes read and written by the call
+         */
+        void addBytes(const std::string& name, uint64_t bytes)
+        {
+            if (enabled)
+                sections[name].bytes += bytes;
+        }
+
+        /**
+         * Get the profile as table sorted by the accumulated time.
+         *
+         * Each section lists the number of calls, the total, mean and maximum
+         * time, its share of the time of all sections and the bandwidth if
+         * bytes were added.
+         */
+        std::string getReport() const
+        {
+            std::vector<std::pair<double, std::string> > order;
+            double sumTime = 0.0;
+            for (SectionMap::const_iterator it = sections.begin(); it != sections.end(); ++it)
+            {
+                order.push_back(std::make_pair(it->second.total.time, it->first));
+                sumTime += it->second.total.time;
+            }
+            std::sort(order.rbegin(), order.rend());
+
+            std::ostringstream out;
+            out << std::left << std::setw(nameWidth) << "section" << std::right <<
+                std::setw(10) << "calls" <<
+                std::setw(14) << "total[ms]" <<
+                std::setw(12) << "mean[ms]" <<
+                std::setw(12) << "max[ms]" <<
+                std::setw(8) << "%" <<
+                std::setw(10) << "GB/s" << std::endl;
+
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                const Section& section = sections.find(order[i].second)->second;
+                printRow(out, order[i].second, section.total, sumTime, section.bytes);
+                for (std::map<uint32_t, Statistics>::const_iterator it = section.areas.begin();
+                     it != section.areas.end(); ++it)
+                    printRow(out, std::string("  ") + getAreaName(it->first), it->second, sumTime, 0);
+            }
+            return out.str();
+        }
+
+        void reset()
+        {
+            sections.clear();
+        }
+
+        /**
+         * Get instance of this class.
+         * This class is a singleton class.
+         * @return an instance
+         */
+        static ProfileRegistry& getInstance()
+        {
+            static ProfileRegistry instance;
+            return instance;
+        }
+
+    private:
+
+        enum
+        {
+            nameWidth = 48
+        };
+
+        struct Statistics
+        {
+            uint64_t calls;
+            /* accumulated time in milliseconds */
+            double time;
+            double maxTime;
+
+            Statistics() : calls(0), time(0.0), maxTime(0.0)
+            {
+            }
+
+            void add(double value)
+            {
+                ++calls;
+                time += value;
+                maxTime = std::max(maxTime, value);
+            }
+        };
+
+        struct Section
+        {
+            Statistics total;
+            /* statistics per area of kernel launches */
+            std::map<uint32_t, Statistics> areas;
+            /* accumulated memory traffic, 0 if unknown */
+            uint64_t bytes;
+
+            Section() : bytes(0)
+            {
+            }
+        };
+
+        typedef std::map<std::string, Section> SectionMap;
+
+        static std::string getAreaName(uint32_t area)
+        {
+            std::string name;
+            if (area & CORE)
+                name += "CORE";
+            if (area & BORDER)
+                name += (name.empty() ? "" : "+") + std::string("BORDER");
+            if (area & GUARD)
+                name += (name.empty() ? "" : "+") + std::string("GUARD");
+            return name;
+        }
+
+        static void printRow(std::ostream& out, const std::string& name,
+                             const Statistics& stats, double sumTime, uint64_t bytes)
+        {
+            out << std::left << std::setw(nameWidth) << name.substr(0, nameWidth - 1) << std::right <<
+                std::setw(10) << stats.calls <<
+                std::fixed << std::setprecision(3) <<
+                std::setw(14) << stats.time <<
+                std::setw(12) << stats.time / (double) stats.calls <<
+                std::setw(12) << stats.maxTime <<
+                std::setprecision(1) <<
+                std::setw(8) << (sumTime > 0.0 ? stats.time / sumTime * 100.0 : 0.0);
+            /* bytes per millisecond to GB/s */
+            if (bytes != 0 && stats.time > 0.0)
+                out << std::setw(10) << (double) bytes / stats.time * 1.0e-6;
+            out << std::endl;
+        }
+
+        ProfileRegistry() : enabled(false)
+        {
+        }
+
+        ProfileRegistry(const ProfileRegistry&);
+
+        bool enabled;
+        SectionMap sections;
+    };
+
+} //namespace PMacc
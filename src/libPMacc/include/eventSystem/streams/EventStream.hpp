@@ -33,6 +33,9 @@ namespace PMacc
 /**
  * Wrapper for a single cuda stream.
  * Allows recording cuda events on the stream.
+ *
+ * If PMACC_CPU_ASYNC_STREAM is enabled each CPU stream owns a worker thread
+ * which executes the enqueued kernels and copies in order.
  */
 class EventStream
 {
@@ -53,7 +56,7 @@ public:
     virtual ~EventStream()
     {
         //wait for all kernels in stream to finish
-        alpaka::wait::wait(stream);
+        waitForIdle();
     }
 
     /**
@@ -73,6 +76,14 @@ public:
         }
     }
 
+    /**
+     * Blocks the calling host thread until all work in this stream is finished.
+     */
+    void waitForIdle()
+    {
+        alpaka::wait::wait(stream);
+    }
+
 private:
     AlpakaAccStream stream;
 };
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "eventSystem/streams/EventStream.hpp"
+#include "debug/VerboseLog.hpp"
 #include "types.h"
 
 
@@ -64,7 +65,11 @@ namespace PMacc
          */
         virtual ~StreamController()
         {
+            /* the destructor of each EventStream waits for its work, for
+             * asynchronous CPU streams this also joins the worker threads
+             */
             streams.clear();
+            dedicatedStreams.clear();
 
             /* This is the single point in PIC where ALL accelerator work must be finished. */
             /* Accessing accelerator objects after this point may fail! */
@@ -83,6 +88,38 @@ namespace PMacc
                 streams.emplace_back(
                     new EventStream(*device.get()));
             }
+            log(ggLog::CUDA_RT(), "StreamController: %1% streams (asynchronous CPU streams: %2%)") %
+                streams.size() % (PMACC_CPU_ASYNC_STREAM == 1);
+        }
+
+        /**
+         * Create an EventStream which is not part of the queue of getNextStream().
+         *
+         * The stream is owned by the controller and only used by transactions
+         * started with it, e.g. to keep all work of a particle species in order
+         * on its own stream.
+         * @return pointer to the new EventStream
+         */
+        EventStream* createDedicatedStream()
+        {
+            dedicatedStreams.emplace_back(
+                new EventStream(*device.get()));
+            return dedicatedStreams.back().get();
+        }
+
+        /**
+         * Blocks until all streams of the controller are idle.
+         *
+         * Used before output and at the end of the simulation, the worker
+         * threads of asynchronous CPU streams may still run kernels which
+         * are not tracked by a task.
+         */
+        void waitForAllStreams()
+        {
+            for (size_t i = 0; i < streams.size(); i++)
+                streams[i]->waitForIdle();
+            for (size_t i = 0; i < dedicatedStreams.size(); i++)
+                dedicatedStreams[i]->waitForIdle();
         }
 
         /** enable StreamController and add one stream
@@ -131,6 +168,7 @@ namespace PMacc
 
         std::unique_ptr<AlpakaAccDev> device;
         std::vector<std::unique_ptr<EventStream>> streams;
+        std::vector<std::unique_ptr<EventStream>> dedicatedStreams;
         size_t currentStreamIndex;
         bool isActivated;
 
@@ -41,6 +41,9 @@
 #include "eventSystem/streams/EventStream.hpp"
 #include "eventSystem/streams/StreamController.hpp"
 
+#include <functional>
+#include <typeinfo>
+
 namespace PMacc
 {
     
@@ -211,9 +214,13 @@ namespace PMacc
     inline TaskKernel* Factory::createTaskKernel(std::string kernelname, ITask *registeringTask)
     {
         TaskKernel* task = new TaskKernel(kernelname);
+        Environment<>::get().TransactionManager().recordTask(std::hash<std::string>()(kernelname));
 
         if (registeringTask != NULL)
+        {
             task->addObserver(registeringTask);
+            Environment<>::get().Manager().addDependency(registeringTask->getId(), task->getId());
+        }
 
         return task;
     }
@@ -223,8 +230,12 @@ namespace PMacc
     {
         if (registeringTask != NULL){
             task.addObserver(registeringTask);
+            /* the registering task reacts on the notification of task and
+             * must not be polled before */
+            Environment<>::get().Manager().addDependency(registeringTask->getId(), task.getId());
         }
         EventTask event(task.getId());
+        Environment<>::get().TransactionManager().recordTask(typeid(task).hash_code());
 
         task.init();
         Environment<>::get().Manager().addTask(&task);
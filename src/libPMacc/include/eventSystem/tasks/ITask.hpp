@@ -25,6 +25,7 @@
 
 #include "eventSystem/events/EventNotify.hpp"
 #include "eventSystem/events/IEvent.hpp"
+#include "eventSystem/tasks/TaskPool.hpp"
 #include "types.h"
 
 #include <string>
@@ -62,6 +63,23 @@ namespace PMacc
         {
         }
 
+        /**
+         * Tasks are allocated from the TaskPool.
+         */
+        static void* operator new(std::size_t size)
+        {
+            return TaskPool::getInstance().allocate(size);
+        }
+
+        /**
+         * The virtual destructor guarantees that size is the size of the
+         * most derived task.
+         */
+        static void operator delete(void* ptr, std::size_t size)
+        {
+            TaskPool::getInstance().deallocate(ptr, size);
+        }
+
         /**
          * Executes this task.
          *
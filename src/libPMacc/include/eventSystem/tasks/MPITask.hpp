@@ -54,6 +54,29 @@ namespace PMacc
         {
         }
 
+        /**
+         * Returns the pending request of a task which wraps a single MPI operation.
+         *
+         * The Manager tests all such requests together and calls
+         * setMPIRequestFinished() if the request is completed.
+         *
+         * @return pointer to the request or NULL if the task composes other tasks
+         */
+        virtual MPI_Request* getMPIRequest()
+        {
+            return NULL;
+        }
+
+        /**
+         * Called by the Manager if the request of getMPIRequest() is completed.
+         * The request is already freed by MPI.
+         *
+         * @param status status of the completed request
+         */
+        virtual void setMPIRequestFinished(const MPI_Status&)
+        {
+        }
+
     protected:
 
         /**
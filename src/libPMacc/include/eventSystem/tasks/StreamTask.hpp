@@ -25,8 +25,6 @@
 #include "eventSystem/tasks/ITask.hpp"
 #include "eventSystem/events/CudaEvent.hpp"
 
-#include <memory>
-
 namespace PMacc
 {
     class EventStream;
@@ -98,7 +96,9 @@ namespace PMacc
 
     private:
         mutable EventStream* stream;
-        std::unique_ptr<CudaEvent> cudaEvent;
+        /* stored by value, a task must not allocate memory on activation */
+        CudaEvent cudaEvent;
+        bool hasCudaEvent;
         bool alwaysFinished;
     };
 
@@ -35,6 +35,7 @@ inline StreamTask::StreamTask( ) :
 ITask( ),
 stream( NULL ),
 cudaEvent( ),
+hasCudaEvent( false ),
 alwaysFinished( false )
 {
     this->setTaskType( TASK_CUDA );
@@ -42,22 +43,23 @@ alwaysFinished( false )
 
 inline CudaEvent StreamTask::getCudaEvent( ) const
 {
-    assert(cudaEvent);
-    return *cudaEvent.get();
+    assert(hasCudaEvent);
+    return cudaEvent;
 }
 
 inline void StreamTask::setCudaEvent(const CudaEvent& cudaEvent )
 {
-    this->cudaEvent.reset(new CudaEvent(cudaEvent));
+    this->cudaEvent = cudaEvent;
+    this->hasCudaEvent = true;
 }
 
 inline bool StreamTask::isFinished( )
 {
     if ( alwaysFinished )
         return true;
-    if(cudaEvent)
+    if(hasCudaEvent)
     {
-        if ( cudaEvent->isFinished( ) )
+        if ( cudaEvent.isFinished( ) )
         {
             alwaysFinished = true;
             return true;
@@ -83,8 +85,9 @@ inline void StreamTask::setEventStream( EventStream* newStream )
 
 inline void StreamTask::activate( )
 {
-    cudaEvent.reset(new CudaEvent(Environment<>::get().Manager().getEventPool().getNextEvent()));
-    cudaEvent->recordEvent(this->stream->getCudaStream());
+    cudaEvent = Environment<>::get().Manager().getEventPool().getNextEvent();
+    hasCudaEvent = true;
+    cudaEvent.recordEvent(this->stream->getCudaStream());
 }
 
 } //namespace PMacc
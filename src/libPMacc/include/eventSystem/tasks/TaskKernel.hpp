@@ -26,10 +26,20 @@
 #include "eventSystem/tasks/StreamTask.hpp"
 #include "eventSystem/streams/EventStream.hpp"
 #include "eventSystem/EventSystem.hpp"
+#include "eventSystem/profiling/ProfileRegistry.hpp"
+#include "simulationControl/TimeInterval.hpp"
 
 namespace PMacc
 {
-     
+
+    /**
+     * Task which represents a kernel enqueued in an EventStream.
+     *
+     * The kernel is finished if the event recorded behind it in the stream
+     * is passed. With asynchronous streams (CUDA or PMACC_CPU_ASYNC_STREAM)
+     * the kernel runs concurrently to the host thread which progresses the
+     * Manager, e.g. polls MPI tasks.
+     */
     class TaskKernel : public StreamTask
     {
     public:
@@ -37,7 +47,9 @@ namespace PMacc
         TaskKernel(std::string kernelName) :
         StreamTask(),
         canBeChecked(false),
-        kernelName(kernelName)
+        kernelName(kernelName),
+        area(0),
+        profileStart(0.0)
         {
         }
 
@@ -68,6 +80,45 @@ namespace PMacc
             __setTransactionEvent(EventTask(this->getId()));
         }
 
+        /**
+         * Set the area the kernel is launched for.
+         * Only used to split the profile per area.
+         */
+        void setArea(uint32_t value)
+        {
+            area = value;
+        }
+
+        /**
+         * Start the time measurement of the kernel.
+         * Must be called directly before the kernel is enqueued.
+         *
+         * Waits for the work already queued in the stream (copies, waits
+         * for events, other kernels), the sample holds only the kernel.
+         */
+        void startProfiling()
+        {
+            if (ProfileRegistry::getInstance().isEnabled())
+            {
+                this->getEventStream()->waitForIdle();
+                profileStart = TimeIntervall::getTime();
+            }
+        }
+
+        /**
+         * Wait for the kernel and add its runtime to the profile.
+         * Must be called directly after the kernel is enqueued.
+         */
+        void stopProfiling()
+        {
+            ProfileRegistry& registry = ProfileRegistry::getInstance();
+            if (registry.isEnabled())
+            {
+                this->getEventStream()->waitForIdle();
+                registry.addSample(kernelName, area, TimeIntervall::getTime() - profileStart);
+            }
+        }
+
         virtual std::string toString()
         {
             return std::string("TaskKernel ") + kernelName;
@@ -80,6 +131,9 @@ namespace PMacc
     private:
         bool canBeChecked;
         std::string kernelName;
+        /* area of the kernel launch, 0 if unknown */
+        uint32_t area;
+        double profileStart;
     };
 
 } //namespace PMacc
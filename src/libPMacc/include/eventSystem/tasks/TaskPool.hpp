@@ -0,0 +1,245 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "types.h"
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace PMacc
+{
+
+    /**
+     * Manages a pool of memory blocks for ITask objects.
+     *
+     * Memory of deleted tasks is not returned to the heap but kept in a free
+     * list per size class and reused for the next task of the same size class.
+     * The containers of the Manager allocate their nodes from the pool, too
+     * (\see TaskPoolAllocator). After the first time steps a task creation
+     * does not touch the heap.
+     * This class is a singleton.
+     */
+    class TaskPool
+    {
+    public:
+
+        /**
+         * Counters since the last call of resetStatistics().
+         */
+        struct Statistics
+        {
+            /* number of allocate() calls (tasks and nodes of the Manager) */
+            uint64_t allocations;
+            /* number of allocate() calls which required heap memory */
+            uint64_t heapAllocations;
+
+            Statistics() : allocations(0), heapAllocations(0)
+            {
+            }
+        };
+
+        /**
+         * Returns a memory block of at least size bytes.
+         * @param size size in bytes
+         * @return pointer to the memory block
+         */
+        void* allocate(size_t size)
+        {
+            ++statistics.allocations;
+            const size_t sizeClass = getSizeClass(size);
+            if (sizeClass < numSizeClasses && !freeLists[sizeClass].empty())
+            {
+                void* ptr = freeLists[sizeClass].back();
+                freeLists[sizeClass].pop_back();
+                return ptr;
+            }
+            ++statistics.heapAllocations;
+            if (sizeClass < numSizeClasses)
+                return ::operator new((sizeClass + 1) * sizeClassBytes);
+            return ::operator new(size);
+        }
+
+        /**
+         * Gives a memory block back to the pool.
+         * @param ptr pointer returned by allocate()
+         * @param size size which was passed to allocate()
+         */
+        void deallocate(void* ptr, size_t size)
+        {
+            if (ptr == NULL)
+                return;
+            const size_t sizeClass = getSizeClass(size);
+            if (sizeClass < numSizeClasses)
+                freeLists[sizeClass].push_back(ptr);
+            else
+                ::operator delete(ptr);
+        }
+
+        const Statistics& getStatistics() const
+        {
+            return statistics;
+        }
+
+        void resetStatistics()
+        {
+            statistics = Statistics();
+        }
+
+        /**
+         * Get instance of this class.
+         * This class is a singleton class.
+         * @return an instance
+         */
+        static TaskPool& getInstance()
+        {
+            static TaskPool instance;
+            return instance;
+        }
+
+        /**
+         * Destructor.
+         * Frees all pooled memory blocks.
+         */
+        virtual ~TaskPool()
+        {
+            for (size_t i = 0; i < numSizeClasses; ++i)
+            {
+                for (size_t j = 0; j < freeLists[i].size(); ++j)
+                    ::operator delete(freeLists[i][j]);
+                freeLists[i].clear();
+            }
+        }
+
+    private:
+
+        enum
+        {
+            /* granularity of the size classes in byte */
+            sizeClassBytes = 64,
+            /* tasks larger than numSizeClasses * sizeClassBytes are not pooled */
+            numSizeClasses = 32
+        };
+
+        TaskPool()
+        {
+        }
+
+        TaskPool(const TaskPool&);
+
+        static size_t getSizeClass(size_t size)
+        {
+            return (size + sizeClassBytes - 1) / sizeClassBytes - 1;
+        }
+
+        std::vector<void*> freeLists[numSizeClasses];
+        Statistics statistics;
+    };
+
+    /**
+     * STL allocator which takes its memory from the TaskPool.
+     *
+     * Used by the containers of the Manager, their nodes are created and
+     * destroyed with every task and are reused like the tasks.
+     */
+    template<typename T>
+    class TaskPoolAllocator
+    {
+    public:
+        typedef T value_type;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+
+        template<typename U>
+        struct rebind
+        {
+            typedef TaskPoolAllocator<U> other;
+        };
+
+        TaskPoolAllocator()
+        {
+        }
+
+        template<typename U>
+        TaskPoolAllocator(const TaskPoolAllocator<U>&)
+        {
+        }
+
+        pointer allocate(size_type n, const void* = 0)
+        {
+            return static_cast<pointer> (TaskPool::getInstance().allocate(n * sizeof (T)));
+        }
+
+        void deallocate(pointer ptr, size_type n)
+        {
+            TaskPool::getInstance().deallocate(ptr, n * sizeof (T));
+        }
+
+        template<typename U, typename... T_Args>
+        void construct(U* ptr, T_Args&&... args)
+        {
+            ::new((void*) ptr) U(std::forward<T_Args>(args)...);
+        }
+
+        template<typename U>
+        void destroy(U* ptr)
+        {
+            ptr->~U();
+        }
+
+        pointer address(reference value) const
+        {
+            return &value;
+        }
+
+        const_pointer address(const_reference value) const
+        {
+            return &value;
+        }
+
+        size_type max_size() const
+        {
+            return size_type(-1) / sizeof (T);
+        }
+
+        template<typename U>
+        bool operator==(const TaskPoolAllocator<U>&) const
+        {
+            return true;
+        }
+
+        template<typename U>
+        bool operator!=(const TaskPoolAllocator<U>&) const
+        {
+            return false;
+        }
+    };
+
+} //namespace PMacc
@@ -115,6 +115,10 @@ namespace PMacc
                 case COPYHOST2DEVICE:
                 case COPYDEVICE2DEVICE:
                     state = Finish;
+                    /* the host buffer is free again, if the task graph is
+                     * replayed the same receive is needed in the next step */
+                    if (Environment<>::get().TransactionManager().isReplayActive())
+                        exchange->prePostReceive();
                     break;
                 default:
                     return;
@@ -27,6 +27,8 @@
 #include "communication/ICommunicator.hpp"
 #include "eventSystem/tasks/MPITask.hpp"
 #include "memory/buffers/Exchange.hpp"
+#include "eventSystem/profiling/ProfileRegistry.hpp"
+#include "simulationControl/TimeInterval.hpp"
 
 #include <mpi.h>
 
@@ -40,7 +42,9 @@ public:
 
     TaskReceiveMPI(Exchange<TYPE, DIM> *exchange) :
     MPITask(),
-    exchange(exchange)
+    exchange(exchange),
+    request(NULL),
+    profileStart(0.0)
     {
 
     }
@@ -48,12 +52,22 @@ public:
     virtual void init()
     {
         __startAtomicTransaction();
-        this->request = Environment<DIM>::get().EnvironmentController()
+        if (ProfileRegistry::getInstance().isEnabled())
+            profileStart = TimeIntervall::getTime();
+        this->request = &(this->requestStorage);
+        if (exchange->takePrePostedReceive(this->requestStorage))
+        {
+            /* the receive was posted at the end of the last round */
+            __endTransaction();
+            return;
+        }
+        Environment<DIM>::get().EnvironmentController()
                 .getCommunicator().startReceive(
                                                 exchange->getExchangeType(),
                                                 (char*) exchange->getHostBuffer().getBasePointer(),
                                                 exchange->getHostBuffer().getDataSpace().productOfComponents() * sizeof (TYPE),
-                                                exchange->getCommunicationTag());
+                                                exchange->getCommunicationTag(),
+                                                this->request);
         __endTransaction();
     }
 
@@ -70,7 +84,6 @@ public:
 
         if (flag) //finished
         {
-            delete this->request;
             this->request = NULL;
             setFinished();
             return true;
@@ -80,17 +93,32 @@ public:
 
     virtual ~TaskReceiveMPI()
     {
+        /* time from the start of the task until its completion is detected */
+        if (profileStart > 0.0)
+            ProfileRegistry::getInstance().addSample("MPI receive", 0, TimeIntervall::getTime() - profileStart);
+
         //\\todo: this make problems because we send bytes and not combined types
         int recv_data_count;
         /* exception inside the destructor are forbidden */
         MPI_CHECK_NOEXCEPT(MPI_Get_count(&(this->status), MPI_CHAR, &recv_data_count));
 
 
-        IEventData *edata = new EventDataReceive(NULL, recv_data_count);
+        EventDataReceive edata(NULL, recv_data_count);
 
-        notify(this->myId, RECVFINISHED, edata); /*add notify her*/
-        __delete(edata);
+        notify(this->myId, RECVFINISHED, &edata); /*add notify her*/
+
+    }
 
+    MPI_Request* getMPIRequest()
+    {
+        return this->request;
+    }
+
+    void setMPIRequestFinished(const MPI_Status& mpiStatus)
+    {
+        this->status = mpiStatus;
+        this->request = NULL;
+        setFinished();
     }
 
     void event(id_t, EventType, IEventData*)
@@ -106,8 +134,11 @@ public:
 
 private:
     Exchange<TYPE, DIM> *exchange;
+    /* points to requestStorage while the request is pending */
     MPI_Request *request;
+    MPI_Request requestStorage;
     MPI_Status status;
+    double profileStart;
 };
 
 } //namespace PMacc
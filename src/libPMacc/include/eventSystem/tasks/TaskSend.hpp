@@ -54,9 +54,12 @@ namespace PMacc
             state = InitDone;
             if (exchange->hasDeviceDoubleBuffer())
             {
-                Environment<>::get().Factory().createTaskCopyDeviceToDevice(exchange->getDeviceBuffer(),
-                                                                               exchange->getDeviceDoubleBuffer()
-                                                                               );
+                if (exchange->isDeviceDoubleBufferFilled())
+                    exchange->setDeviceDoubleBufferFilled(false);
+                else
+                    Environment<>::get().Factory().createTaskCopyDeviceToDevice(exchange->getDeviceBuffer(),
+                                                                                   exchange->getDeviceDoubleBuffer()
+                                                                                   );
                 copyEvent = Environment<>::get().Factory().createTaskCopyDeviceToHost(exchange->getDeviceDoubleBuffer(),
                                                                                          exchange->getHostBuffer(),
                                                                                          this);
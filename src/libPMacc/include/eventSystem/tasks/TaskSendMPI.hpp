@@ -27,6 +27,8 @@
 #include "communication/ICommunicator.hpp"
 #include "eventSystem/tasks/MPITask.hpp"
 #include "memory/buffers/Exchange.hpp"
+#include "eventSystem/profiling/ProfileRegistry.hpp"
+#include "simulationControl/TimeInterval.hpp"
 
 #include <mpi.h>
 
@@ -40,7 +42,9 @@ public:
 
     TaskSendMPI(Exchange<TYPE, DIM> *exchange) :
     MPITask(),
-    exchange(exchange)
+    exchange(exchange),
+    request(NULL),
+    profileStart(0.0)
     {
 
     }
@@ -48,12 +52,16 @@ public:
     virtual void init()
     {
         __startTransaction();
-        this->request = Environment<DIM>::get().EnvironmentController()
+        if (ProfileRegistry::getInstance().isEnabled())
+            profileStart = TimeIntervall::getTime();
+        this->request = &(this->requestStorage);
+        Environment<DIM>::get().EnvironmentController()
                 .getCommunicator().startSend(
                                              exchange->getExchangeType(),
                                              (char*) exchange->getHostBuffer().getPointer(),
                                              exchange->getHostBuffer().getCurrentSize() * sizeof (TYPE),
-                                             exchange->getCommunicationTag());
+                                             exchange->getCommunicationTag(),
+                                             this->request);
         __endTransaction();
     }
 
@@ -70,7 +78,6 @@ public:
 
         if (flag) //finished
         {
-            delete this->request;
             this->request = NULL;
             this->setFinished();
             return true;
@@ -80,9 +87,25 @@ public:
 
     virtual ~TaskSendMPI()
     {
+        /* time from the start of the task until its completion is detected */
+        if (profileStart > 0.0)
+            ProfileRegistry::getInstance().addSample("MPI send", 0, TimeIntervall::getTime() - profileStart);
+
         notify(this->myId, SENDFINISHED, NULL);
     }
 
+    MPI_Request* getMPIRequest()
+    {
+        return this->request;
+    }
+
+    void setMPIRequestFinished(const MPI_Status& mpiStatus)
+    {
+        this->status = mpiStatus;
+        this->request = NULL;
+        this->setFinished();
+    }
+
     void event(id_t, EventType, IEventData*)
     {
 
@@ -95,8 +118,11 @@ public:
 
 private:
     Exchange<TYPE, DIM> *exchange;
+    /* points to requestStorage while the request is pending */
     MPI_Request *request;
+    MPI_Request requestStorage;
     MPI_Status status;
+    double profileStart;
 };
 
 } //namespace PMacc
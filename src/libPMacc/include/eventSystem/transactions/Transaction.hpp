@@ -44,6 +44,17 @@ public:
      */
     Transaction(const EventTask& event, bool isAtomic = false);
 
+    /**
+     * Constructor for a transaction bound to a stream.
+     *
+     * All StreamTasks of the transaction and of transactions started on top
+     * of it are enqueued in stream.
+     *
+     * @param event initial EventTask for base event
+     * @param stream EventStream used for all operations
+     */
+    Transaction(const EventTask& event, EventStream* stream, bool isAtomic = false);
+
     /**
      * Adds event to the base event of this transaction.
      *
@@ -72,10 +83,14 @@ public:
      */
     EventStream* getEventStream(ITask::TaskType operation);
 
+    /* true if the transaction was started with an explicit stream */
+    bool isStreamBound() const;
+
 private:
     EventTask baseEvent;
     EventStream* eventStream;
     bool isAtomic;
+    bool streamBound;
 
 };
 
@@ -31,7 +31,17 @@ namespace PMacc
 Transaction::Transaction(const EventTask& event, bool isAtomic ) :
     baseEvent(event),
     eventStream(Environment<>::get().StreamController().getNextStream()),
-    isAtomic(isAtomic)
+    isAtomic(isAtomic),
+    streamBound(false)
+{
+    event.waitForFinished( );
+}
+
+Transaction::Transaction(const EventTask& event, EventStream* stream, bool isAtomic ) :
+    baseEvent(event),
+    eventStream(stream),
+    isAtomic(isAtomic),
+    streamBound(true)
 {
     event.waitForFinished( );
 }
@@ -70,4 +80,9 @@ EventStream* Transaction::getEventStream( ITask::TaskType )
     return this->eventStream;
 }
 
+inline bool Transaction::isStreamBound( ) const
+{
+    return streamBound;
+}
+
 } //namespace PMacc
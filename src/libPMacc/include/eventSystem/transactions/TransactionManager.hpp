@@ -25,8 +25,10 @@
 #include "eventSystem/EventSystem.hpp"
 #include "eventSystem/transactions/Transaction.hpp"
 
+#include <set>
 #include <stack>
 #include <memory>
+#include <vector>
 
 namespace PMacc
 {
@@ -36,6 +38,27 @@ class Environment;
 
 class EventStream;
 
+/**
+ * A receive which is posted before the task which waits for it exists.
+ *
+ * Pending receives are registered at the TransactionManager and are
+ * cancelled with TransactionManager::cancelPrePostedReceives() before MPI
+ * is finalized.
+ */
+class IPrePostedReceive
+{
+public:
+
+    virtual ~IPrePostedReceive()
+    {
+    }
+
+    /**
+     * Cancel the pending receive and wait until MPI released it.
+     */
+    virtual void cancelPrePostedReceive() = 0;
+};
+
 /**
  * Manages the task/event synchronization system using task 'transactions'.
  * Transactions are grouped on a stack.
@@ -62,6 +85,17 @@ public:
      */
     void startAtomicTransaction(EventTask serialEvent = EventTask());
 
+    /**
+     * Adds a new transaction bound to a stream to the stack.
+     *
+     * Transactions started on top of a stream bound transaction use the
+     * same stream instead of the next stream of the StreamController.
+     *
+     * @param serialEvent initial base event for new transaction
+     * @param stream EventStream for all StreamTasks of the transaction
+     */
+    void startStreamTransaction(EventTask serialEvent, EventStream* stream);
+
     /**
      * Removes the top-most transaction from the stack.
      *
@@ -94,6 +128,61 @@ public:
 
     EventStream* getEventStream(ITask::TaskType op);
 
+    /**
+     * Starts recording the signatures of all tasks created until endCapture().
+     */
+    void startCapture();
+
+    /**
+     * Stops recording and compares the captured task graph with the graph of
+     * the previous capture.
+     *
+     * If replay is enabled and both graphs are equal the replay mode is active
+     * until a different graph is captured.
+     *
+     * @return true if the captured graph is equal to the previous one
+     */
+    bool endCapture();
+
+    /**
+     * Appends a task to the captured graph (no-op outside of a capture).
+     *
+     * @param taskSignature identifies the kind of the task, e.g. a kernel name
+     */
+    void recordTask(size_t taskSignature);
+
+    /**
+     * Allows the event system to rely on the captured task graph.
+     *
+     * Task objects are not reused, they are still created every step (from
+     * the TaskPool). While two consecutive steps create the same graph the
+     * receive tasks post the MPI receive of the next step in advance.
+     * Disabling cancels all pre-posted receives.
+     */
+    void setReplayEnabled(bool enabled);
+
+    /**
+     * Returns if the task graph of the current step is expected to be equal
+     * to the last captured graph.
+     */
+    bool isReplayActive() const;
+
+    /**
+     * Register a pending receive which was posted in advance.
+     */
+    void addPrePostedReceive(IPrePostedReceive* receive);
+
+    /**
+     * Remove a receive which was taken over by its task or cancelled.
+     */
+    void removePrePostedReceive(IPrePostedReceive* receive);
+
+    /**
+     * Cancel all pending pre-posted receives, must be called before MPI is
+     * finalized.
+     */
+    void cancelPrePostedReceives();
+
 private:
 
     friend class Environment<DIM1>;
@@ -107,6 +196,15 @@ private:
     static TransactionManager& getInstance();
 
     std::stack<std::unique_ptr<Transaction>> transactions;
+
+    /* task signatures of the running and the last finished capture */
+    std::vector<size_t> capturedGraph;
+    std::vector<size_t> lastCapturedGraph;
+    bool isCapturing;
+    bool replayEnabled;
+    bool replayActive;
+    /* receives posted in advance which are not taken by a task yet */
+    std::set<IPrePostedReceive*> prePostedReceives;
 };
 
 
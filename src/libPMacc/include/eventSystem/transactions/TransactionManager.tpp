@@ -36,7 +36,10 @@ inline TransactionManager::~TransactionManager() noexcept(false)
     transactions.pop( );
 }
 
-inline TransactionManager::TransactionManager( )
+inline TransactionManager::TransactionManager( ) :
+isCapturing( false ),
+replayEnabled( false ),
+replayActive( false )
 {
     startTransaction( EventTask( ) );
 }
@@ -48,12 +51,23 @@ inline TransactionManager::TransactionManager( const TransactionManager& )
 
 inline void TransactionManager::startTransaction( EventTask serialEvent )
 {
-    transactions.emplace(new Transaction(serialEvent, false));
+    if ( transactions.size( ) != 0 && transactions.top( )->isStreamBound( ) )
+        transactions.emplace(new Transaction(serialEvent, transactions.top( )->getEventStream( ITask::TASK_CUDA ), false));
+    else
+        transactions.emplace(new Transaction(serialEvent, false));
 }
 
 inline void TransactionManager::startAtomicTransaction( EventTask serialEvent )
 {
-    transactions.emplace(new Transaction(serialEvent, true));
+    if ( transactions.size( ) != 0 && transactions.top( )->isStreamBound( ) )
+        transactions.emplace(new Transaction(serialEvent, transactions.top( )->getEventStream( ITask::TASK_CUDA ), true));
+    else
+        transactions.emplace(new Transaction(serialEvent, true));
+}
+
+inline void TransactionManager::startStreamTransaction( EventTask serialEvent, EventStream* stream )
+{
+    transactions.emplace(new Transaction(serialEvent, stream, false));
 }
 
 inline EventTask TransactionManager::endTransaction( )
@@ -98,6 +112,69 @@ inline EventTask TransactionManager::getTransactionEvent( )
     return transactions.top( )->getTransactionEvent( );
 }
 
+inline void TransactionManager::startCapture( )
+{
+    capturedGraph.clear( );
+    isCapturing = true;
+}
+
+inline bool TransactionManager::endCapture( )
+{
+    isCapturing = false;
+    const bool isEqual = ( capturedGraph == lastCapturedGraph );
+    /* swap keeps the capacity of both vectors, no allocation in steady state */
+    lastCapturedGraph.swap( capturedGraph );
+
+    const bool newReplayState = replayEnabled && isEqual;
+    if ( newReplayState != replayActive )
+    {
+        log<ggLog::INFO >( "task graph replay %1% (%2% tasks per step)" ) %
+            ( newReplayState ? "started" : "stopped" ) % lastCapturedGraph.size( );
+    }
+    replayActive = newReplayState;
+    return isEqual;
+}
+
+inline void TransactionManager::recordTask( size_t taskSignature )
+{
+    if ( isCapturing )
+        capturedGraph.push_back( taskSignature );
+}
+
+inline void TransactionManager::setReplayEnabled( bool enabled )
+{
+    replayEnabled = enabled;
+    if ( !replayEnabled )
+    {
+        replayActive = false;
+        cancelPrePostedReceives( );
+    }
+}
+
+inline void TransactionManager::addPrePostedReceive( IPrePostedReceive* receive )
+{
+    prePostedReceives.insert( receive );
+}
+
+inline void TransactionManager::removePrePostedReceive( IPrePostedReceive* receive )
+{
+    prePostedReceives.erase( receive );
+}
+
+inline void TransactionManager::cancelPrePostedReceives( )
+{
+    /* cancelPrePostedReceive() does not touch the set */
+    for ( std::set<IPrePostedReceive*>::iterator it = prePostedReceives.begin( );
+          it != prePostedReceives.end( ); ++it )
+        ( *it )->cancelPrePostedReceive( );
+    prePostedReceives.clear( );
+}
+
+inline bool TransactionManager::isReplayActive( ) const
+{
+    return replayActive;
+}
+
 inline TransactionManager& TransactionManager::getInstance( )
 {
     static TransactionManager instance;
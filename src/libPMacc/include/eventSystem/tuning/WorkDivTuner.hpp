@@ -0,0 +1,255 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#pragma once
+
+#include "types.h"
+#include "debug/VerboseLog.hpp"
+
+#include <fstream>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace PMacc
+{
+
+    /**
+     * Selects the number of threads per block for kernels with a free
+     * work division.
+     *
+     * A kernel is identified by a key (usually the kernel name passed to
+     * createTaskKernel() plus the parts of the signature which influence
+     * the performance). While tuning is enabled each candidate of a key is
+     * used for samplesPerCandidate launches and the caller reports the
+     * measured time with addMeasurement(). After all candidates are measured
+     * the fastest one is used for all further launches.
+     *
+     * Winners can be stored to a cache file and are reused without
+     * measurement in later runs.
+     * Kernels where the block size is coupled to the data layout
+     * (e.g. one thread per cell of a supercell) must not pass free block
+     * sizes, they can tune a layout compatible parameter instead
+     * (e.g. the number of threads per cell of FieldJ::computeCurrent).
+     *
+     * Multiple MPI ranks: each rank measures and selects its winners
+     * independently, there is no communication between the ranks.
+     * The winners can differ if the ranks hold a different load.
+     * store() is only called on rank 0, thus the cache file contains the
+     * winners of rank 0 and all ranks of the next run use these.
+     *
+     * This class is a singleton.
+     */
+    class WorkDivTuner
+    {
+    public:
+
+        /**
+         * Enable or disable the tuning.
+         * If disabled getBlockSize() always returns the default block size.
+         */
+        void setEnabled(bool value)
+        {
+            enabled = value;
+        }
+
+        bool isEnabled() const
+        {
+            return enabled;
+        }
+
+        /**
+         * Set the cache file and load all stored winners.
+         *
+         * A missing file is not an error, it is created by store().
+         * @param filename path to the cache file
+         */
+        void setCacheFile(const std::string& filename)
+        {
+            cacheFile = filename;
+            std::ifstream file(cacheFile.c_str());
+            std::string key;
+            uint32_t blockSize;
+            while (file >> key >> blockSize)
+                cachedWinners[key] = blockSize;
+            if (!cachedWinners.empty())
+                log<ggLog::CUDA_RT > ("work division tuner: loaded %1% entries from %2%") %
+                    cachedWinners.size() % cacheFile;
+        }
+
+        /**
+         * Returns the number of threads per block for the next launch.
+         *
+         * @param key identifier of the kernel
+         * @param candidates block sizes to measure (the default is used if empty)
+         * @param defaultSize block size used if the tuner is disabled
+         * @return block size for the next launch
+         */
+        uint32_t getBlockSize(const std::string& key,
+                              const std::vector<uint32_t>& candidates,
+                              uint32_t defaultSize)
+        {
+            if (!enabled || candidates.empty())
+                return defaultSize;
+
+            std::map<std::string, uint32_t>::const_iterator cached = cachedWinners.find(key);
+            if (cached != cachedWinners.end())
+                return cached->second;
+
+            std::map<std::string, Entry>::iterator it = entries.find(key);
+            if (it == entries.end())
+            {
+                Entry entry;
+                entry.candidates = candidates;
+                entry.bestTimes.resize(candidates.size(), std::numeric_limits<double>::max());
+                it = entries.insert(std::make_pair(key, entry)).first;
+            }
+            Entry& entry = it->second;
+            if (entry.isFinished())
+                return entry.winner;
+            return entry.candidates[entry.current];
+        }
+
+        /**
+         * Returns true if the next launch of the kernel is measured.
+         * Only in this case the caller must synchronize and call
+         * addMeasurement().
+         */
+        bool isMeasuring(const std::string& key) const
+        {
+            if (!enabled || cachedWinners.find(key) != cachedWinners.end())
+                return false;
+            std::map<std::string, Entry>::const_iterator it = entries.find(key);
+            return it != entries.end() && !it->second.isFinished();
+        }
+
+        /**
+         * Report the runtime of a launch which used the block size returned
+         * by the previous getBlockSize() call for the key.
+         *
+         * @param key identifier of the kernel
+         * @param time runtime in milliseconds
+         */
+        void addMeasurement(const std::string& key, double time)
+        {
+            std::map<std::string, Entry>::iterator it = entries.find(key);
+            if (it == entries.end() || it->second.isFinished())
+                return;
+            Entry& entry = it->second;
+
+            /* the minimum is robust against disturbances of other ranks or processes */
+            if (time < entry.bestTimes[entry.current])
+                entry.bestTimes[entry.current] = time;
+
+            if (++entry.samples < samplesPerCandidate)
+                return;
+            entry.samples = 0;
+            ++entry.current;
+            if (!entry.isFinished())
+                return;
+
+            size_t best = 0;
+            for (size_t i = 1; i < entry.candidates.size(); ++i)
+                if (entry.bestTimes[i] < entry.bestTimes[best])
+                    best = i;
+            entry.winner = entry.candidates[best];
+            log<ggLog::CUDA_RT > ("work division tuner: %1% uses %2% (%3% ms)") %
+                key % entry.winner % entry.bestTimes[best];
+        }
+
+        /**
+         * Write the cached and all finished tuning results to the cache file.
+         * Nothing is written if no cache file is set.
+         */
+        void store() const
+        {
+            if (cacheFile.empty())
+                return;
+
+            std::map<std::string, uint32_t> winners(cachedWinners);
+            for (std::map<std::string, Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it)
+                if (it->second.isFinished())
+                    winners[it->first] = it->second.winner;
+            if (winners.empty())
+                return;
+
+            std::ofstream file(cacheFile.c_str());
+            for (std::map<std::string, uint32_t>::const_iterator it = winners.begin(); it != winners.end(); ++it)
+                file << it->first << " " << it->second << std::endl;
+        }
+
+        /**
+         * Get instance of this class.
+         * This class is a singleton class.
+         * @return an instance
+         */
+        static WorkDivTuner& getInstance()
+        {
+            static WorkDivTuner instance;
+            return instance;
+        }
+
+    private:
+
+        enum
+        {
+            /* number of measured launches per candidate */
+            samplesPerCandidate = 3
+        };
+
+        struct Entry
+        {
+            std::vector<uint32_t> candidates;
+            /* fastest measured runtime per candidate in milliseconds */
+            std::vector<double> bestTimes;
+            /* index of the measured candidate */
+            size_t current;
+            /* number of measurements of the current candidate */
+            uint32_t samples;
+            uint32_t winner;
+
+            Entry() : current(0), samples(0), winner(0)
+            {
+            }
+
+            bool isFinished() const
+            {
+                return current >= candidates.size();
+            }
+        };
+
+        WorkDivTuner() : enabled(false)
+        {
+        }
+
+        WorkDivTuner(const WorkDivTuner&);
+
+        bool enabled;
+        std::string cacheFile;
+        std::map<std::string, Entry> entries;
+        std::map<std::string, uint32_t> cachedWinners;
+    };
+
+} //namespace PMacc
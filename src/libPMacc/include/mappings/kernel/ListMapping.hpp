@@ -0,0 +1,105 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "types.h"
+#include "dimensions/DataSpace.hpp"
+#include "memory/boxes/DataBox.hpp"
+#include "memory/boxes/PitchedBox.hpp"
+
+namespace PMacc
+{
+
+template<class baseClass>
+class ListMapping;
+
+/**
+ * Maps blocks to supercells given by an explicit list of supercell indices
+ *
+ * Block i (along x) of a kernel call works on the supercell
+ * list[offset + i]. The list lives in device memory and is created e.g.
+ * by ActiveSuperCellList.
+ */
+template<
+template<unsigned, class> class baseClass,
+unsigned DIM,
+class SuperCellSize_
+>
+class ListMapping<baseClass<DIM, SuperCellSize_> > : public baseClass<DIM, SuperCellSize_>
+{
+public:
+    typedef baseClass<DIM, SuperCellSize_> BaseClass;
+    typedef DataBox<PitchedBox<DataSpace<DIM>, DIM1> > ListBox;
+
+    enum
+    {
+        Dim = BaseClass::Dim
+    };
+
+    typedef typename BaseClass::SuperCellSize SuperCellSize;
+
+    HINLINE ListMapping(BaseClass base, ListBox list, uint32_t offset, uint32_t size) :
+    BaseClass(base), list(list), offset(offset), size(size)
+    {
+    }
+
+    /**
+     * Generate grid dimension information for kernel calls
+     *
+     * All blocks are laid out along x, a kernel must not be called if
+     * getSize() is zero.
+     *
+     * @return size of the grid
+     */
+    HINLINE DataSpace<DIM> getGridDim() const
+    {
+        DataSpace<DIM> gridDim(DataSpace<DIM>::create(1));
+        gridDim.x() = size;
+        return gridDim;
+    }
+
+    /**
+     * Returns index of current logical block
+     *
+     * @param realSuperCellIdx current SuperCell index (block index)
+     * @return mapped SuperCell index
+     */
+    HDINLINE DataSpace<DIM> getSuperCellIndex(const DataSpace<DIM>& realSuperCellIdx) const
+    {
+        return list[offset + realSuperCellIdx.x()];
+    }
+
+    /* number of supercells in the list */
+    HDINLINE uint32_t getSize() const
+    {
+        return size;
+    }
+
+private:
+    PMACC_ALIGN(list, ListBox);
+    PMACC_ALIGN(offset, uint32_t);
+    PMACC_ALIGN(size, uint32_t);
+};
+
+} // namespace PMacc
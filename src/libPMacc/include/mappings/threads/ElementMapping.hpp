@@ -0,0 +1,88 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "dimensions/DataSpace.hpp"
+#include "types.h"
+
+namespace PMacc
+{
+
+/** Work division of kernels which are launched with one thread per cell of
+ * a supercell (AlpakaSuperCellAcc).
+ *
+ * If PMACC_SUPERCELL_PER_THREAD is 1 a block has only one thread and the
+ * cells of the supercell are the elements of this thread, otherwise each
+ * thread processes exactly one element.
+ * Kernels must iterate over getElemCount() elements starting at
+ * getFirstElem() instead of using the linear thread index directly.
+ */
+struct ElementMapping
+{
+    /** thread extent of a block
+     *
+     * @param block cells (threads) per block
+     */
+    template<unsigned T_dim>
+    static HINLINE DataSpace<T_dim> getThreadExtent(const DataSpace<T_dim>& block)
+    {
+#if (PMACC_SUPERCELL_PER_THREAD == 1)
+        return DataSpace<T_dim>::create(1);
+#else
+        return block;
+#endif
+    }
+
+    /** element extent of a thread
+     *
+     * @param block cells (threads) per block
+     */
+    template<unsigned T_dim>
+    static HINLINE DataSpace<T_dim> getElemExtent(const DataSpace<T_dim>& block)
+    {
+#if (PMACC_SUPERCELL_PER_THREAD == 1)
+        return block;
+#else
+        return DataSpace<T_dim>::create(1);
+#endif
+    }
+
+    /** number of elements processed by the current thread */
+    template<typename T_Acc>
+    static DINLINE int getElemCount(const T_Acc& acc)
+    {
+        return static_cast<int>(alpaka::workdiv::getWorkDiv<alpaka::Thread, alpaka::Elems>(acc).prod());
+    }
+
+    /** linear index of the first element processed by the current thread
+     *
+     * @param linearThreadIdx linear thread index within the block
+     */
+    template<typename T_Acc>
+    static DINLINE int getFirstElem(const T_Acc& acc, const int linearThreadIdx)
+    {
+        return linearThreadIdx * getElemCount(acc);
+    }
+};
+
+} //namespace PMacc
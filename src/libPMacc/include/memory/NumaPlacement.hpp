@@ -0,0 +1,311 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "debug/VerboseLog.hpp"
+#include "dimensions/DataSpace.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#if (PMACC_CPU_FIRST_TOUCH == 1)
+#   include <omp.h>
+#   include <sched.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
+
+namespace PMacc
+{
+
+/**
+ * Places the memory of CPU device buffers on the NUMA nodes of the threads
+ * which work on it.
+ *
+ * Linux places a page on the NUMA node of the thread which touches it
+ * first. If PMACC_CPU_FIRST_TOUCH is 1 the OpenMP threads of the kernel
+ * teams are pinned to the cores of the process and new buffers are
+ * initialized with the decomposition of the kernels into blocks
+ * (see setBlockExtent()) instead of by the master thread:
+ *  - AccCpuOmp2Threads (default): the blocks are executed one after the
+ *    other, OpenMP thread t of a block works on the cell with the linear
+ *    index t inside the block
+ *  - AccCpuOmp2Blocks (PMACC_SUPERCELL_PER_THREAD): each OpenMP thread
+ *    works on whole blocks with a static schedule
+ * Otherwise all methods are no-ops.
+ *
+ * This class is a singleton.
+ */
+class NumaPlacement
+{
+public:
+
+    /**
+     * Set the extent of a kernel block, e.g. the supercell size.
+     *
+     * Must be called before pinThreads(), buffers created before are
+     * placed with one block per page.
+     *
+     * @param extent extent of a block in elements, missing components are 1
+     */
+    void setBlockExtent(const DataSpace<DIM3>& extent)
+    {
+        blockExtent = extent;
+    }
+
+    /**
+     * Pin each OpenMP thread of a kernel team to one core of the process
+     * affinity mask.
+     *
+     * The mask given by the MPI launcher is respected, the threads are
+     * distributed round robin over the allowed cores. If the OpenMP
+     * runtime binds its threads itself (OMP_PROC_BIND, OMP_PLACES) the
+     * threads are left untouched.
+     *
+     * With synchronous streams the master thread is thread 0 of all kernel
+     * teams and stays pinned to the first core. With asynchronous streams
+     * the kernels are executed by the stream worker threads, which inherit
+     * the mask of the master and own separate OpenMP teams, thus the master
+     * gets back the process mask and only its own team is pinned.
+     */
+    void pinThreads()
+    {
+#if (PMACC_CPU_FIRST_TOUCH == 1)
+        if (omp_get_proc_bind() != omp_proc_bind_false)
+        {
+            log<ggLog::MEMORY > ("OpenMP threads are bound by the OpenMP runtime");
+            return;
+        }
+
+        cpu_set_t processMask;
+        CPU_ZERO(&processMask);
+        if (sched_getaffinity(0, sizeof (processMask), &processMask) != 0)
+            return;
+
+        std::vector<int> cores;
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            if (CPU_ISSET(cpu, &processMask))
+                cores.push_back(cpu);
+        if (cores.empty())
+            return;
+
+        const int teamSize = getTeamSize();
+        #pragma omp parallel num_threads(teamSize)
+        {
+            cpu_set_t threadMask;
+            CPU_ZERO(&threadMask);
+            CPU_SET(cores[omp_get_thread_num() % cores.size()], &threadMask);
+            sched_setaffinity(0, sizeof (threadMask), &threadMask);
+        }
+#if (PMACC_CPU_ASYNC_STREAM == 1)
+        sched_setaffinity(0, sizeof (processMask), &processMask);
+        log<ggLog::MEMORY > ("pinned OpenMP threads 1 to %1% of the master to %2% cores, "
+                             "the master keeps the process mask for the stream threads") %
+            (teamSize - 1) % cores.size();
+#else
+        log<ggLog::MEMORY > ("pinned %1% OpenMP threads to %2% cores") %
+            teamSize % cores.size();
+#endif
+#endif
+    }
+
+    /**
+     * Zero a buffer with the OpenMP threads which work on it in kernels.
+     *
+     * Must be called before any other thread touches the memory.
+     *
+     * @param ptr begin of the memory region
+     * @param dataSpace extent of the buffer in elements
+     * @param pitch bytes per row (x) including padding
+     * @param elemSize size of an element in bytes
+     */
+    template<unsigned DIM>
+    void firstTouch(void* ptr, const DataSpace<DIM>& dataSpace, size_t pitch, size_t elemSize)
+    {
+#if (PMACC_CPU_FIRST_TOUCH == 1)
+        const size_t bytes = pitch * (dataSpace.productOfComponents() / dataSpace.x());
+        if (ptr == NULL || bytes == 0)
+            return;
+        char* const data = static_cast<char*> (ptr);
+
+        DataSpace<DIM3> extent(1, 1, 1);
+        DataSpace<DIM3> block(1, 1, 1);
+        for (unsigned d = 0; d < DIM; ++d)
+        {
+            extent[d] = dataSpace[d];
+            block[d] = blockExtent[d];
+        }
+        if (blockExtent.productOfComponents() == 1)
+            block.x() = std::max<int>(1, sysconf(_SC_PAGESIZE) / elemSize);
+
+        const DataSpace<DIM3> numBlocks(
+            (extent.x() + block.x() - 1) / block.x(),
+            (extent.y() + block.y() - 1) / block.y(),
+            (extent.z() + block.z() - 1) / block.z());
+        const int blockCount = numBlocks.productOfComponents();
+        const size_t slicePitch = pitch * extent.y();
+
+#if (PMACC_SUPERCELL_PER_THREAD == 1)
+        #pragma omp parallel for schedule(static)
+        for (int linearBlock = 0; linearBlock < blockCount; ++linearBlock)
+        {
+            const DataSpace<DIM3> blockIndex(
+                linearBlock % numBlocks.x(),
+                (linearBlock / numBlocks.x()) % numBlocks.y(),
+                linearBlock / (numBlocks.x() * numBlocks.y()));
+            const DataSpace<DIM3> begin(blockIndex * block);
+            const int rowSize = std::min(block.x(), extent.x() - begin.x());
+            for (int z = begin.z(); z < std::min(begin.z() + block.z(), extent.z()); ++z)
+                for (int y = begin.y(); y < std::min(begin.y() + block.y(), extent.y()); ++y)
+                    memset(data + z * slicePitch + y * pitch + begin.x() * elemSize, 0, rowSize * elemSize);
+        }
+#else
+        const int threadsPerBlock = block.productOfComponents();
+        #pragma omp parallel num_threads(threadsPerBlock)
+        {
+            const int t = omp_get_thread_num();
+            const DataSpace<DIM3> threadIndex(
+                t % block.x(),
+                (t / block.x()) % block.y(),
+                t / (block.x() * block.y()));
+            for (int linearBlock = 0; linearBlock < blockCount; ++linearBlock)
+            {
+                const DataSpace<DIM3> blockIndex(
+                    linearBlock % numBlocks.x(),
+                    (linearBlock / numBlocks.x()) % numBlocks.y(),
+                    linearBlock / (numBlocks.x() * numBlocks.y()));
+                const DataSpace<DIM3> cell(blockIndex * block + threadIndex);
+                if (cell.x() < extent.x() && cell.y() < extent.y() && cell.z() < extent.z())
+                    memset(data + cell.z() * slicePitch + cell.y() * pitch + cell.x() * elemSize, 0, elemSize);
+            }
+        }
+#endif
+        regions.push_back(Region(data, bytes));
+#endif
+    }
+
+    /**
+     * Forget a memory region which was passed to firstTouch().
+     *
+     * @param ptr begin of the memory region
+     */
+    void release(void* ptr)
+    {
+        for (size_t i = 0; i < regions.size(); ++i)
+        {
+            if (regions[i].ptr == ptr)
+            {
+                regions.erase(regions.begin() + i);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Log the size of all first touched memory regions per NUMA node.
+     *
+     * The node of every page is queried with the move_pages system call
+     * (without moving the page).
+     */
+    void report() const
+    {
+#if (PMACC_CPU_FIRST_TOUCH == 1)
+        const long pageSize = sysconf(_SC_PAGESIZE);
+        std::map<int, size_t> bytesPerNode;
+
+        for (size_t i = 0; i < regions.size(); ++i)
+        {
+            const size_t numPages = (regions[i].bytes + pageSize - 1) / pageSize;
+            std::vector<void*> pages(numPages);
+            std::vector<int> status(numPages, -1);
+            for (size_t page = 0; page < numPages; ++page)
+                pages[page] = regions[i].ptr + page * pageSize;
+
+            if (syscall(SYS_move_pages, 0, numPages, &pages[0], NULL, &status[0], 0) != 0)
+            {
+                log<ggLog::MEMORY > ("NUMA placement is not available on this system");
+                return;
+            }
+            for (size_t page = 0; page < numPages; ++page)
+                bytesPerNode[status[page]] += pageSize;
+        }
+
+        for (std::map<int, size_t>::const_iterator it = bytesPerNode.begin(); it != bytesPerNode.end(); ++it)
+        {
+            if (it->first < 0)
+                log<ggLog::MEMORY > ("NUMA node unknown: %1% MiB") % (it->second / 1024 / 1024);
+            else
+                log<ggLog::MEMORY > ("NUMA node %1%: %2% MiB") % it->first % (it->second / 1024 / 1024);
+        }
+#endif
+    }
+
+    /**
+     * Get instance of this class.
+     * This class is a singleton class.
+     * @return an instance
+     */
+    static NumaPlacement& getInstance()
+    {
+        static NumaPlacement instance;
+        return instance;
+    }
+
+private:
+
+    struct Region
+    {
+        char* ptr;
+        size_t bytes;
+
+        Region(char* ptr, size_t bytes) : ptr(ptr), bytes(bytes)
+        {
+        }
+    };
+
+    NumaPlacement() : blockExtent(1, 1, 1)
+    {
+    }
+
+#if (PMACC_CPU_FIRST_TOUCH == 1)
+    /* number of OpenMP threads which execute a kernel block */
+    int getTeamSize() const
+    {
+#if (PMACC_SUPERCELL_PER_THREAD == 1)
+        return omp_get_max_threads();
+#else
+        return blockExtent.productOfComponents() > 1 ? blockExtent.productOfComponents() : omp_get_max_threads();
+#endif
+    }
+#endif
+
+    NumaPlacement(const NumaPlacement&);
+
+    std::vector<Region> regions;
+    DataSpace<DIM3> blockExtent;
+};
+
+} //namespace PMacc
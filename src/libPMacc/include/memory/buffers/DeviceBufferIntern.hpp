@@ -25,6 +25,7 @@
 #include "dimensions/DataSpace.hpp"
 #include "eventSystem/tasks/Factory.hpp"
 #include "memory/buffers/DeviceBuffer.hpp"
+#include "memory/NumaPlacement.hpp"
 #include "memory/boxes/DataBox.hpp"
 #include "algorithms/TypeCast.hpp"
 
@@ -67,6 +68,13 @@ public:
         }
         this->setCurrentSize(this->getDataSpace().productOfComponents());
 
+        /* place the pages before they are touched by reset() */
+        NumaPlacement::getInstance().firstTouch(
+            getBasePointer(),
+            this->getDataSpace(),
+            this->is1D() ? this->getDataSpace().x() * sizeof (TYPE) : getPitch(),
+            sizeof (TYPE));
+
         reset(false);
     }
 
@@ -91,6 +99,8 @@ public:
     {
         __startOperation(ITask::TASK_CUDA);
         m_upSizeOnDevice.reset();
+        if(m_upDataBufDev)
+            NumaPlacement::getInstance().release(getBasePointer());
     }
 
     void reset(bool preserveData = true)
@@ -240,6 +250,16 @@ public:
     };
 
 private:
+    /*! Size of the owned memory in bytes including the padding of the rows
+     */
+    size_t getAllocatedBytes()
+    {
+        const size_t numElements = this->getDataSpace().productOfComponents();
+        if (this->is1D())
+            return numElements * sizeof (TYPE);
+        return getPitch() * (numElements / this->getDataSpace().x());
+    }
+
     /*! Creates a ND-buffer with pitch
      */
     DataBufDev createData()
@@ -25,6 +25,8 @@
 #include "memory/buffers/DeviceBuffer.hpp"
 #include "memory/buffers/HostBuffer.hpp"
 
+#include <mpi.h>
+
 namespace PMacc
 {
 
@@ -82,17 +84,55 @@ namespace PMacc
 
         virtual DeviceBuffer<TYPE, DIM>& getDeviceDoubleBuffer()=0;
 
+        /**
+         * Returns whether the device double buffer already holds the data
+         * of the next send, written by GridBuffer::asyncBashSendExchanges.
+         *
+         * @return true if the copy into the double buffer can be skipped
+         */
+        bool isDeviceDoubleBufferFilled() const
+        {
+            return deviceDoubleBufferFilled;
+        }
+
+        void setDeviceDoubleBufferFilled(bool filled)
+        {
+            deviceDoubleBufferFilled = filled;
+        }
+
+        /**
+         * Posts the receive of the next message before the receive task is created.
+         *
+         * The host buffer must not be used until the message is received.
+         */
+        virtual void prePostReceive()
+        {
+        }
+
+        /**
+         * Hands over a pre-posted receive request.
+         *
+         * @param request is set to the pending request
+         * @return true if a pre-posted request was available, else false
+         */
+        virtual bool takePrePostedReceive(MPI_Request&)
+        {
+            return false;
+        }
+
     protected:
 
         Exchange(uint32_t extype, uint32_t tag) :
         exchange(extype),
-        communicationTag(tag)
+        communicationTag(tag),
+        deviceDoubleBufferFilled(false)
         {
 
         }
 
         uint32_t exchange;
         uint32_t communicationTag;
+        bool deviceDoubleBufferFilled;
     };
 
 }
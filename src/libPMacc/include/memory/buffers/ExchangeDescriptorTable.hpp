@@ -0,0 +1,210 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "dimensions/DataSpace.hpp"
+#include "dimensions/DataSpaceOperations.hpp"
+#include "memory/boxes/DataBox.hpp"
+#include "memory/boxes/PitchedBox.hpp"
+#include "memory/buffers/HostBufferIntern.hpp"
+#include "memory/buffers/DeviceBufferIntern.hpp"
+
+#include <alpaka/alpaka.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace PMacc
+{
+
+/**
+ * Describes one exchange of a fused halo kernel.
+ *
+ * All exchanges of a GridBuffer are launched as one linear grid of blocks;
+ * a block finds its exchange via firstBlock.
+ */
+template<typename T_DataBox, unsigned T_dim>
+struct ExchangeDescriptor
+{
+    /* data box the exchange is written to */
+    T_DataBox exchangeBox;
+    /* extent of the exchange in cells */
+    DataSpace<T_dim> exchangeSize;
+    /* first cell of the exchange area within the source buffer */
+    DataSpace<T_dim> origin;
+    /* first linear block of this exchange within the fused grid */
+    uint32_t firstBlock;
+};
+
+/**
+ * Table of all exchanges of a fused halo kernel.
+ *
+ * The table is filled on the host with add() and uploaded once with commit().
+ * Kernels receive the device data box and the number of exchanges and look up
+ * their descriptor with findExchangeDescriptor().
+ *
+ * @tparam T_DataBox data box type of the exchange buffers
+ * @tparam T_dim dimension of the exchange buffers
+ */
+template<typename T_DataBox, unsigned T_dim>
+class ExchangeDescriptorTable
+{
+public:
+    typedef ExchangeDescriptor<T_DataBox, T_dim> Descriptor;
+    typedef DataBox<PitchedBox<Descriptor, DIM1> > DataBoxType;
+
+    /* number of threads of a block of the fused grid */
+    static const uint32_t blockSize = 256;
+
+    ExchangeDescriptorTable() : numBlocks(0)
+    {
+    }
+
+    /**
+     * Append an exchange to the table
+     *
+     * @param exchangeBox data box the exchange is written to
+     * @param exchangeSize extent of the exchange in cells
+     * @param origin first cell of the exchange area within the source buffer
+     */
+    void add(const T_DataBox& exchangeBox,
+             const DataSpace<T_dim>& exchangeSize,
+             const DataSpace<T_dim>& origin)
+    {
+        Descriptor descriptor;
+        descriptor.exchangeBox = exchangeBox;
+        descriptor.exchangeSize = exchangeSize;
+        descriptor.origin = origin;
+        descriptor.firstBlock = numBlocks;
+
+        numBlocks += (exchangeSize.productOfComponents() + blockSize - 1) / blockSize;
+        descriptors.push_back(descriptor);
+    }
+
+    /**
+     * Upload the table to the device
+     *
+     * Must be called once after the last add().
+     */
+    void commit()
+    {
+        if (descriptors.empty())
+            return;
+
+        DataSpace<DIM1> tableSize(static_cast<int>(descriptors.size()));
+        hostTable.reset(new HostBufferIntern<Descriptor, DIM1>(tableSize));
+        deviceTable.reset(new DeviceBufferIntern<Descriptor, DIM1>(tableSize));
+
+        DataBoxType hostBox = hostTable->getDataBox();
+        for (size_t i = 0; i < descriptors.size(); ++i)
+            hostBox[i] = descriptors[i];
+
+        deviceTable->copyFrom(*hostTable);
+    }
+
+    DataBoxType getDeviceDataBox() const
+    {
+        return deviceTable->getDataBox();
+    }
+
+    /* number of blocks of all exchanges */
+    uint32_t getNumBlocks() const
+    {
+        return numBlocks;
+    }
+
+    uint32_t getNumExchanges() const
+    {
+        return static_cast<uint32_t>(descriptors.size());
+    }
+
+private:
+    std::vector<Descriptor> descriptors;
+    std::unique_ptr<HostBufferIntern<Descriptor, DIM1> > hostTable;
+    std::unique_ptr<DeviceBufferIntern<Descriptor, DIM1> > deviceTable;
+    uint32_t numBlocks;
+};
+
+/**
+ * Find the exchange a block of a fused halo kernel belongs to
+ *
+ * The table is ordered by firstBlock and holds at most 26 exchanges,
+ * therefore a linear search is sufficient.
+ *
+ * @param table device data box of an ExchangeDescriptorTable
+ * @param numExchanges number of exchanges in the table
+ * @param linearBlock linear block index within the fused grid
+ * @return index of the exchange in the table
+ */
+template<typename T_TableBox>
+HDINLINE uint32_t findExchangeDescriptor(const T_TableBox& table,
+                                         uint32_t numExchanges,
+                                         uint32_t linearBlock)
+{
+    uint32_t exchange = 0;
+    while (exchange + 1 < numExchanges && table[exchange + 1].firstBlock <= linearBlock)
+        ++exchange;
+    return exchange;
+}
+
+/**
+ * Copy the exchange areas of a buffer into the exchange buffers
+ *
+ * one-dimensional grid over all blocks of an ExchangeDescriptorTable,
+ * each thread copies one cell
+ */
+struct KernelBashExchanges
+{
+    template<
+        typename T_Acc,
+        typename T_SourceBox,
+        typename T_TableBox>
+    ALPAKA_FN_ACC void operator()(
+        T_Acc const & acc,
+        T_SourceBox const & source,
+        T_TableBox const & exchanges,
+        uint32_t const numExchanges,
+        uint32_t const blockSize) const
+    {
+        static_assert(
+            alpaka::dim::Dim<T_Acc>::value == 1,
+            "The KernelBashExchanges functor has to be called with a one dimensional accelerator!");
+
+        DataSpace<DIM1> const blockIndex(alpaka::idx::getIdx<alpaka::Grid, alpaka::Blocks>(acc));
+        DataSpace<DIM1> const threadIndex(alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc));
+
+        const uint32_t linearBlock = blockIndex.x();
+        PMACC_AUTO(exchange, exchanges[findExchangeDescriptor(exchanges, numExchanges, linearBlock)]);
+
+        const int linearCell = (linearBlock - exchange.firstBlock) * blockSize + threadIndex.x();
+        if (linearCell >= exchange.exchangeSize.productOfComponents())
+            return;
+
+        const DataSpace<T_SourceBox::Dim> cell(
+            DataSpaceOperations<T_SourceBox::Dim>::map(exchange.exchangeSize, linearCell));
+        exchange.exchangeBox(cell) = source(exchange.origin + cell);
+    }
+};
+
+} //namespace PMacc
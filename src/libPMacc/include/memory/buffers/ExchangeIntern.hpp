@@ -31,6 +31,8 @@
 
 #include "eventSystem/tasks/Factory.hpp"
 #include "eventSystem/tasks/TaskReceive.hpp"
+#include "eventSystem/transactions/TransactionManager.hpp"
+#include "communication/manager_common.h"
 
 #include "types.h"
 
@@ -43,13 +45,14 @@ namespace PMacc
      * Internal Exchange implementation.
      */
     template <class TYPE, unsigned DIM>
-    class ExchangeIntern : public Exchange<TYPE, DIM>
+    class ExchangeIntern : public Exchange<TYPE, DIM>, public IPrePostedReceive
     {
     public:
 
         ExchangeIntern(DeviceBufferIntern<TYPE, DIM>& source, GridLayout<DIM> memoryLayout, DataSpace<DIM> guardingCells, uint32_t exchange,
                        uint32_t communicationTag, uint32_t area = BORDER, bool sizeOnDevice = false) :
-        Exchange<TYPE, DIM>(exchange, communicationTag), deviceDoubleBuffer()
+        Exchange<TYPE, DIM>(exchange, communicationTag), deviceDoubleBuffer(),
+        viewOfSource(true), allowPrePostReceive(true), hasPrePostedReceive(false), prePostedRank(0)
         {
 
             assert(!guardingCells.isOneDimensionGreaterThan(memoryLayout.getGuard()));
@@ -83,7 +86,8 @@ namespace PMacc
 
         ExchangeIntern(DataSpace<DIM> exchangeDataSpace, uint32_t exchange,
                        uint32_t communicationTag, bool sizeOnDevice = false) :
-        Exchange<TYPE, DIM>(exchange, communicationTag), deviceDoubleBuffer()
+        Exchange<TYPE, DIM>(exchange, communicationTag), deviceDoubleBuffer(),
+        viewOfSource(false), allowPrePostReceive(false), hasPrePostedReceive(false), prePostedRank(0)
         {
             this->deviceBuffer.reset(new DeviceBufferIntern<TYPE, DIM > (exchangeDataSpace, sizeOnDevice));
             //  this->deviceBuffer.reset(new DeviceBufferIntern<TYPE, DIM > (exchangeDataSpace, sizeOnDevice,true));
@@ -121,6 +125,9 @@ namespace PMacc
 
         virtual ~ExchangeIntern()
         {
+            /* pre-posted receives are cancelled by the TransactionManager
+             * at the end of the simulation, before MPI is finalized */
+            assert(!hasPrePostedReceive);
             hostBuffer.reset();
             deviceBuffer.reset();
             deviceDoubleBuffer.reset();
@@ -216,6 +223,15 @@ namespace PMacc
             return *deviceDoubleBuffer;
         }
 
+        /**
+         * Returns whether the device buffer is a part of the GridBuffer's
+         * memory (created by GridBuffer::addExchange).
+         */
+        bool isViewOfSource() const
+        {
+            return viewOfSource;
+        }
+
         EventTask startSend(EventTask &copyEvent)
         {
             //assert(recvTask != NULL);
@@ -227,6 +243,58 @@ namespace PMacc
             return Environment<>::get().Factory().createTaskReceive(*this);
         }
 
+        /**
+         * Only exchanges with a fixed layout (halos of a GridBuffer) are
+         * pre-posted, the host buffer is used for nothing else.
+         */
+        virtual void prePostReceive()
+        {
+            if (!allowPrePostReceive || hasPrePostedReceive)
+                return;
+
+            ICommunicator& comm = Environment<DIM>::get().EnvironmentController().getCommunicator();
+            prePostedRank = comm.getNeighborRank(this->getExchangeType());
+            comm.startReceive(
+                this->getExchangeType(),
+                (char*) this->getHostBuffer().getBasePointer(),
+                this->getHostBuffer().getDataSpace().productOfComponents() * sizeof (TYPE),
+                this->getCommunicationTag(),
+                &prePostedRequest);
+            hasPrePostedReceive = true;
+            Environment<>::get().TransactionManager().addPrePostedReceive(this);
+        }
+
+        virtual bool takePrePostedReceive(MPI_Request& request)
+        {
+            if (!hasPrePostedReceive)
+                return false;
+            hasPrePostedReceive = false;
+            Environment<>::get().TransactionManager().removePrePostedReceive(this);
+
+            ICommunicator& comm = Environment<DIM>::get().EnvironmentController().getCommunicator();
+            if (comm.getNeighborRank(this->getExchangeType()) != prePostedRank)
+            {
+                /* the window slid after the receive was posted, the old
+                 * neighbor never sends this message */
+                MPI_CHECK(MPI_Cancel(&prePostedRequest));
+                MPI_CHECK(MPI_Wait(&prePostedRequest, MPI_STATUS_IGNORE));
+                return false;
+            }
+            request = prePostedRequest;
+            return true;
+        }
+
+        /* called by the TransactionManager which forgets this receive */
+        virtual void cancelPrePostedReceive()
+        {
+            if (!hasPrePostedReceive)
+                return;
+            /* the message of the pre-posted receive is never requested */
+            MPI_CHECK(MPI_Cancel(&prePostedRequest));
+            MPI_CHECK(MPI_Wait(&prePostedRequest, MPI_STATUS_IGNORE));
+            hasPrePostedReceive = false;
+        }
+
     protected:
         std::unique_ptr<HostBufferIntern<TYPE, DIM>> hostBuffer;
 
@@ -235,6 +303,11 @@ namespace PMacc
         std::unique_ptr<DeviceBufferIntern<TYPE, DIM>> deviceDoubleBuffer;
         std::unique_ptr<DeviceBufferIntern<TYPE, DIM>> deviceBuffer;
 
+        bool viewOfSource;
+        bool allowPrePostReceive;
+        bool hasPrePostedReceive;
+        MPI_Request prePostedRequest;
+        int prePostedRank;
     };
 
 }
@@ -29,11 +29,18 @@
 #include "memory/buffers/ExchangeIntern.hpp"
 #include "memory/buffers/HostBufferIntern.hpp"
 #include "memory/buffers/DeviceBufferIntern.hpp"
+#include "memory/buffers/ExchangeDescriptorTable.hpp"
+#include "eventSystem/events/kernelEvents.hpp"
+
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 #include <sstream>
 #include <stdexcept>
 #include <algorithm>
 #include <set>
+#include <map>
+#include <utility>
 
 namespace PMacc
 {
@@ -93,6 +100,7 @@ class GridBuffer
 public:
 
     typedef DataBox<PitchedBox<TYPE, DIM> > DataBoxType;
+    typedef ExchangeDescriptorTable<DataBox<PitchedBox<BORDERTYPE, DIM> >, DIM> ExchangeTable;
 
     /**
      * Constructor.
@@ -178,6 +186,7 @@ public:
             receiveExchanges[i].reset();
         }
 
+        bashTables.clear();
         hostBuffer.reset();
         deviceBuffer.reset();
     }
@@ -331,6 +340,42 @@ public:
         }
     }
 
+    /**
+     * Reallocate the dedicated exchange buffers of one direction.
+     *
+     * The send exchange sendEx and the receive exchange of the mirrored
+     * direction get the new size, their content is lost.
+     * Only buffers created with addExchangeBuffer() can be resized.
+     * The neighbors must resize their corresponding exchanges at the same
+     * time, else received messages are truncated.
+     *
+     * @param sendEx send direction
+     * @param dataSpace new size of the exchange buffers
+     * @param sizeOnDevice if true, internal buffers have their size information on the device, too
+     */
+    void resizeExchangeBuffer(uint32_t sendEx, const DataSpace<DIM> &dataSpace, bool sizeOnDevice = false)
+    {
+        const ExchangeType recvex = Mask::getMirroredExchangeType(sendEx);
+        /* do not use hasSendExchange(), exchanges without a neighbor are resized too */
+        if (sendExchanges[sendEx] == NULL || receiveExchanges[recvex] == NULL)
+            throw std::runtime_error("Exchange to resize does not exist!");
+
+        sendEvents[sendEx].waitForFinished();
+        receiveEvents[recvex].waitForFinished();
+        /* the tables hold the data boxes of the old buffers */
+        bashTables.clear();
+
+        const uint32_t uniqCommunicationTag = sendExchanges[sendEx]->getCommunicationTag();
+
+        /* free the old buffers first to keep the peak memory usage low */
+        sendExchanges[sendEx].reset();
+        receiveExchanges[recvex].reset();
+        sendExchanges[sendEx].reset(
+            new ExchangeIntern<BORDERTYPE, DIM>(dataSpace, sendEx, uniqCommunicationTag, sizeOnDevice));
+        receiveExchanges[recvex].reset(
+            new ExchangeIntern<BORDERTYPE, DIM>(dataSpace, recvex, uniqCommunicationTag, sizeOnDevice));
+    }
+
     /**
      * Returns whether this GridBuffer has an Exchange for sending in ex direction.
      *
@@ -447,24 +492,113 @@ public:
      */
     EventTask asyncCommunication(EventTask serialEvent)
     {
+        Mask allExchanges;
+        for (uint32_t i = 0; i < maxExchange; ++i)
+            allExchanges = allExchanges + Mask(i);
+        return asyncCommunication(serialEvent, allExchanges);
+    }
+
+    /**
+     * Starts sync data from own device buffer to neighbor device buffer
+     * for a subset of all exchanges.
+     *
+     * Receives each exchange set in exchanges and sends its mirrored
+     * exchange, so all ranks which call this method with the same mask
+     * exchange matching data.
+     *
+     * @param serialEvent event the communication depends on
+     * @param exchanges exchanges to receive
+     */
+    EventTask asyncCommunication(EventTask serialEvent, const Mask& exchanges)
+    {
+        /* send exchanges which are a part of this buffer are copied to their
+         * double buffers with one kernel instead of one copy per exchange */
+        Mask views;
+        for (uint32_t i = 0; i < maxExchange; ++i)
+        {
+            ExchangeType sendEx = Mask::getMirroredExchangeType(i);
+            if (exchanges.isSet(i) && hasSendExchange(sendEx) && sendExchanges[sendEx]->isViewOfSource())
+                views = views + Mask(sendEx);
+        }
+        EventTask bashEvent = asyncBashViewExchanges(
+            serialEvent,
+            views,
+            boost::mpl::bool_<(DIM > DIM1) && boost::is_same<TYPE, BORDERTYPE>::value>());
+
         EventTask evR;
         for (uint32_t i = 0; i < maxExchange; ++i)
         {
+            if (!exchanges.isSet(i))
+                continue;
 
             evR += asyncReceive(serialEvent, i);
 
             ExchangeType sendEx = Mask::getMirroredExchangeType(i);
 
             EventTask copyEvent;
-            asyncSend(serialEvent, sendEx, copyEvent);
+            asyncSend(views.isSet(sendEx) ? bashEvent : serialEvent, sendEx, copyEvent);
             /* add only the copy event, because all work on gpu can run after data is copyed
              */
             evR += copyEvent;
-
         }
         return evR;
     }
 
+    /**
+     * Copies the data of several send exchanges with one kernel.
+     *
+     * Each exchange is written to its device double buffer, or to its own
+     * device buffer if it has no double buffer, and the following asyncSend()
+     * skips its device to device copy.
+     * Exchanges which are a part of this buffer and have no double buffer
+     * need no copy and are skipped.
+     *
+     * Can only be used if TYPE and BORDERTYPE are equal.
+     *
+     * @param serialEvent event the copy depends on
+     * @param sends send exchanges to copy
+     * @param area area of this buffer dedicated exchange buffers are filled from [GUARD | BORDER],
+     *        exchanges created with addExchange() know their area
+     * @return event of the copy
+     */
+    EventTask asyncBashSendExchanges(EventTask serialEvent, const Mask& sends, uint32_t area)
+    {
+        Mask bashed;
+        EventTask lastSends;
+        for (uint32_t ex = 1; ex < maxExchange; ++ex)
+        {
+            if (!sends.isSet(ex) || !hasSendExchange(ex))
+                continue;
+            if (sendExchanges[ex]->isViewOfSource() && !sendExchanges[ex]->hasDeviceDoubleBuffer())
+                continue;
+            bashed = bashed + Mask(ex);
+            /* the previous send may still read the target buffer */
+            lastSends += sendEvents[ex];
+        }
+        if (bashed == 0u)
+            return serialEvent;
+
+        ExchangeTable& table = getBashTable(bashed, area);
+
+        __startAtomicTransaction(serialEvent + lastSends);
+        KernelBashExchanges kernelBashExchanges;
+        __cudaKernel(
+            kernelBashExchanges,
+            alpaka::dim::DimInt<1u>,
+            DataSpace<DIM1>(table.getNumBlocks()),
+            DataSpace<DIM1>(ExchangeTable::blockSize))(
+                deviceBuffer->getDataBox(),
+                table.getDeviceDataBox(),
+                table.getNumExchanges(),
+                ExchangeTable::blockSize);
+        for (uint32_t ex = 1; ex < maxExchange; ++ex)
+        {
+            if (bashed.isSet(ex) && sendExchanges[ex]->hasDeviceDoubleBuffer())
+                sendExchanges[ex]->setDeviceDoubleBufferFilled(true);
+        }
+        return __endTransaction();
+    }
+
     EventTask asyncSend(EventTask serialEvent, uint32_t sendEx, EventTask &gpuFree)
     {
         if (hasSendExchange(sendEx))
@@ -523,6 +657,50 @@ private:
 
     friend class Environment<DIM>;
 
+    EventTask asyncBashViewExchanges(EventTask serialEvent, const Mask& views, boost::mpl::bool_<true>)
+    {
+        return asyncBashSendExchanges(serialEvent, views, BORDER);
+    }
+
+    /* no double buffers or exchanges of another type, nothing to copy */
+    EventTask asyncBashViewExchanges(EventTask serialEvent, const Mask&, boost::mpl::bool_<false>)
+    {
+        return serialEvent;
+    }
+
+    /**
+     * Returns the table of the exchanges set in bashed, created on first use.
+     */
+    ExchangeTable& getBashTable(const Mask& bashed, uint32_t area)
+    {
+        const std::pair<uint32_t, uint32_t> key(static_cast<uint32_t>(bashed), area);
+        std::unique_ptr<ExchangeTable>& table = bashTables[key];
+        if (table)
+            return *table;
+
+        table.reset(new ExchangeTable());
+        for (uint32_t ex = 1; ex < maxExchange; ++ex)
+        {
+            if (!bashed.isSet(ex))
+                continue;
+
+            ExchangeIntern<BORDERTYPE, DIM>& exchange = *sendExchanges[ex];
+            DeviceBuffer<BORDERTYPE, DIM>& target =
+                exchange.hasDeviceDoubleBuffer() ? exchange.getDeviceDoubleBuffer() : exchange.getDeviceBuffer();
+            const DataSpace<DIM> size(exchange.getDeviceBuffer().getDataSpace());
+
+            DataSpace<DIM> origin;
+            if (exchange.isViewOfSource())
+                origin = exchange.getDeviceBuffer().getOffset() - deviceBuffer->getOffset();
+            else
+                origin = exchange.exchangeTypeToOffset(ex, gridLayout, size, area);
+
+            table->add(target.getDataBox(), size, origin);
+        }
+        table->commit();
+        return *table;
+    }
+
     void init(bool sizeOnDevice, bool buildDeviceBuffer = true, bool buildHostBuffer = true)
     {
         for (uint32_t i = 0; i < 27; ++i)
@@ -561,6 +739,9 @@ protected:
     EventTask sendEvents[27];
 
     uint32_t maxExchange; //use max exchanges and run over the array is faster as use set from stl
+
+    /* tables of asyncBashSendExchanges, key is the mask of the exchanges and the area */
+    std::map<std::pair<uint32_t, uint32_t>, std::unique_ptr<ExchangeTable> > bashTables;
 };
 
 }
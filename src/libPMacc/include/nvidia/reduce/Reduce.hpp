@@ -22,13 +22,18 @@
 
 #pragma once
 
+#include "eventSystem/tuning/WorkDivTuner.hpp"
 #include "memory/buffers/GridBuffer.hpp"
 #include "nvidia/functors/Assign.hpp"
+#include "simulationControl/TimeInterval.hpp"
 #include "traits/GetValueType.hpp"
 #include "types.h"
 
 #include <type_traits>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace PMacc
 {
@@ -169,6 +174,7 @@ namespace PMacc
                     const uint32_t sharedMemByte = 4 * 1024) :
                         byte(byte),
                         sharedMemByte(sharedMemByte),
+                        maxThreadsPerBlock(512),
                         reduceBuffer(new GridBuffer<char, DIM1>(DataSpace<DIM1>(byte)))
                 {}
 
@@ -189,6 +195,27 @@ namespace PMacc
                      *   thus we remove `references` and `const` qualifiers */
                     using Type = typename std::decay<typename traits::GetValueType<Src>::ValueType>::type;
 
+                    /* the upper limit of threads per block is selected by the
+                     * work division tuner, the result is equal for all limits
+                     * except for the rounding order of floating point values
+                     *
+                     * the best limit depends on the number of elements,
+                     * therefore n is part of the key as power of two bucket */
+                    uint32_t sizeBucket = 0;
+                    while ((n >> sizeBucket) > 1u)
+                        ++sizeBucket;
+                    std::stringstream tuningKey;
+                    tuningKey << "KernelReduction_" << sizeof (Type) << "_n2^" << sizeBucket;
+                    WorkDivTuner& tuner = WorkDivTuner::getInstance();
+                    maxThreadsPerBlock = tuner.getBlockSize(tuningKey.str(), tuningCandidates(), 512);
+                    const bool measure = tuner.isMeasuring(tuningKey.str());
+                    TimeIntervall tReduce;
+                    if (measure)
+                    {
+                        __getTransactionEvent().waitForFinished();
+                        tReduce.toggleStart();
+                    }
+
                     uint32_t blockcount = optimalThreadsPerBlock(n, sizeof (Type));
 
                     uint32_t const n_buffer = byte / sizeof (Type);
@@ -240,6 +267,11 @@ namespace PMacc
 
                     reduceBuffer->deviceToHost();
                     __getTransactionEvent().waitForFinished();
+                    if (measure)
+                    {
+                        tReduce.toggleEnd();
+                        tuner.addMeasurement(tuningKey.str(), tReduce.getInterval());
+                    }
                     return *((Type*) (reduceBuffer->getHostBuffer().getBasePointer()));
 
                 }
@@ -258,6 +290,7 @@ namespace PMacc
                     ///        and add possible threads accordingly.
                     ///        maybe this function should be exported
                     ///        to a more general nvidia class, too.
+                    if (threads >= maxThreadsPerBlock) return maxThreadsPerBlock;
                     if (threads >= 512) return 512;
                     if (threads >= 256) return 256;
                     if (threads >= 128) return 128;
@@ -271,6 +304,15 @@ namespace PMacc
                     return 1;
                 }
 
+                /* block size limits measured by the work division tuner */
+                static std::vector<uint32_t> tuningCandidates()
+                {
+                    std::vector<uint32_t> candidates;
+                    for (uint32_t threads = 64; threads <= 1024; threads *= 2)
+                        candidates.push_back(threads);
+                    return candidates;
+                }
+
                 /*calculate optimal number of thredas per block with respect to shared memory limitations
                  * @param n number of elements to reduce
                  * @param sizePerElement size in bytes per elements
@@ -286,6 +328,8 @@ namespace PMacc
                 uint32_t byte;
                 /*shared memory limit in byte for one block*/
                 uint32_t sharedMemByte;
+                /*upper limit of threads per block (power of two)*/
+                uint32_t maxThreadsPerBlock;
                 /*global gpu buffer for reduce steps*/
                 std::unique_ptr<GridBuffer<char, DIM1>> reduceBuffer;
 
@@ -24,6 +24,7 @@
 
 #include <boost/mpl/vector.hpp>
 #include "compileTime/conversion/ToSeq.hpp"
+#include "math/Vector.hpp"
 
 namespace PMacc
 {
@@ -48,6 +49,9 @@ namespace PMacc
  *                      (this allows pointers and references to a frame itself)
  *                    - the finale frame that uses ParticleDescription inherits from all
  *                      extension classes
+ * @tparam T_FrameSize compile time number of particles in a frame
+ *                     (boost::mpl integral constant, default: number of cells
+ *                     in a super cell)
  */
 template<
 typename T_Name,
@@ -55,7 +59,8 @@ typename T_SuperCellSize,
 typename T_ValueTypeSeq,
 typename T_Flags = bmpl::vector0<>,
 typename T_MethodsList = bmpl::vector0<>,
-typename T_FrameExtensionList = bmpl::vector0<>
+typename T_FrameExtensionList = bmpl::vector0<>,
+typename T_FrameSize = typename math::CT::volume<T_SuperCellSize>::type
 >
 struct ParticleDescription
 {
@@ -65,13 +70,15 @@ struct ParticleDescription
     typedef typename ToSeq<T_MethodsList>::type MethodsList;
     typedef typename ToSeq<T_Flags>::type FlagsList;
     typedef typename ToSeq<T_FrameExtensionList>::type FrameExtensionList;
+    typedef T_FrameSize FrameSize;
     typedef ParticleDescription<
         Name,
         SuperCellSize,
         ValueTypeSeq,
         FlagsList,
         MethodsList,
-        FrameExtensionList
+        FrameExtensionList,
+        FrameSize
     > ThisType;
 
 };
@@ -93,7 +100,8 @@ struct ReplaceValueTypeSeq
     typename ToSeq<T_NewValueTypeSeq>::type,
     typename OldParticleDescription::FlagsList,
     typename OldParticleDescription::MethodsList,
-    typename OldParticleDescription::FrameExtensionList
+    typename OldParticleDescription::FrameExtensionList,
+    typename OldParticleDescription::FrameSize
     > type;
 };
 
@@ -113,7 +121,8 @@ struct ReplaceFrameExtensionSeq
     typename OldParticleDescription::ValueTypeSeq,
     typename OldParticleDescription::FlagsList,
     typename OldParticleDescription::MethodsList,
-    typename ToSeq<T_FrameExtensionSeq>::type
+    typename ToSeq<T_FrameExtensionSeq>::type,
+    typename OldParticleDescription::FrameSize
     > type;
 };
 
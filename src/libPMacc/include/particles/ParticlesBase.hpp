@@ -28,6 +28,8 @@
 
 #include "particles/memory/boxes/ParticlesBox.hpp"
 #include "particles/memory/buffers/ParticlesBuffer.hpp"
+#include "particles/memory/buffers/ActiveSuperCellList.hpp"
+#include "particles/memory/buffers/SuperCellWorkList.hpp"
 
 #include "mappings/kernel/StrideMapping.hpp"
 #include "traits/NumberOfExchanges.hpp"
@@ -56,18 +58,85 @@ public:
      */
     typedef ParticlesBox< FrameType, MappingDesc::Dim> ParticlesBoxType;
 
+    /* Type of the list of supercells which hold particles
+     */
+    typedef ActiveSuperCellList<MappingDesc> ActiveSuperCellListType;
+
+    /* Type of the list of supercells which must be shifted
+     */
+    typedef SuperCellWorkList<MappingDesc> ShiftListType;
+
     static constexpr int Dim = MappingDesc::Dim;
     static constexpr int Exchanges = traits::NumberOfExchanges<Dim>::value;
     static constexpr size_t TileSize = math::CT::volume<typename MappingDesc::SuperCellSize>::type::value;
+    /* particle kernels of this class run one thread per frame slot */
+    static constexpr size_t FrameSize = FrameType::FrameSize::value;
+
+    /* the shift kernels initialize one destination frame per thread */
+    static_assert(
+        FrameSize >= static_cast<size_t>(Exchanges),
+        "A frame must hold at least as many particles as a supercell has neighbors (8 in 2D, 26 in 3D)");
 
 protected:
 
     BufferType *particlesBuffer;
 
-    ParticlesBase(MappingDesc description) : SimulationFieldHelper<MappingDesc>(description), particlesBuffer(NULL)
+    ActiveSuperCellListType activeSuperCells;
+
+    /* supercells from which particles leave, appended by the push */
+    ShiftListType mustShiftSuperCells;
+
+    /* stream for the push, shift and exchange of this species */
+    EventStream* eventStream;
+
+    /* last event of the work enqueued in eventStream */
+    EventTask streamEvent;
+
+    ParticlesBase(MappingDesc description) :
+    SimulationFieldHelper<MappingDesc>(description), particlesBuffer(NULL),
+    activeSuperCells(description), mustShiftSuperCells(description),
+    eventStream(Environment<>::get().StreamController().createDedicatedStream())
     {
     }
 
+    /* Shift particles and fill gaps in all supercells of a mapper
+     *
+     * Supercells of one call must be at least three supercells apart
+     * (StrideMapping with stride 3 or one stride class of the active list).
+     */
+    template<class T_Mapping>
+    void shiftSuperCells(const T_Mapping& mapper)
+    {
+        ParticlesBoxType pBox = particlesBuffer->getDeviceParticleBox();
+        DataSpace<Dim> blockSize(DataSpace<Dim>::create(1));
+        blockSize.x() = static_cast<AlpakaIdxSize>(FrameSize);
+
+#if (PMACC_SHIFT_PREFIX_SUM == 1) && (PMACC_SUPERCELL_PER_THREAD == 0)
+        KernelShiftParticlesScan kernelShiftParticles;
+#else
+        KernelShiftParticles kernelShiftParticles;
+#endif
+        __cudaKernelSuperCell(kernelShiftParticles,
+                     alpaka::dim::DimInt<Dim>,
+                     mapper.getGridDim(),
+                     blockSize)
+            (pBox, mapper);
+
+        KernelFillGaps kernelFillGaps;
+        __cudaKernel(kernelFillGaps,
+                     alpaka::dim::DimInt<Dim>,
+                     mapper.getGridDim(),
+                     blockSize)
+            (pBox, mapper);
+
+        KernelFillGapsLastFrame kernelFillGapsLastFrame;
+        __cudaKernel(kernelFillGapsLastFrame,
+                     alpaka::dim::DimInt<Dim>,
+                     mapper.getGridDim(),
+                     blockSize)
+            (pBox, mapper);
+    }
+
     /* Shift all particle in a AREA
      * @tparam AREA area which is used (CORE,BORDER,GUARD or a combination)
      */
@@ -75,38 +144,73 @@ protected:
     void shiftParticles()
     {
         StrideMapping<AREA, 3, MappingDesc> mapper(this->cellDescription);
-        ParticlesBoxType pBox = particlesBuffer->getDeviceParticleBox();
-        DataSpace<Dim> blockSize(DataSpace<Dim>::create(1));
-        blockSize.x() = static_cast<AlpakaIdxSize>(TileSize);
 
         __startTransaction(__getTransactionEvent());
         do
         {
-            KernelShiftParticles kernelShiftParticles;
-            __cudaKernel(kernelShiftParticles,
-                         alpaka::dim::DimInt<Dim>,
-                         mapper.getGridDim(),
-                         blockSize)
-                (pBox, mapper);
-
-            KernelFillGaps kernelFillGaps;
-            __cudaKernel(kernelFillGaps,
-                         alpaka::dim::DimInt<Dim>,
-                         mapper.getGridDim(),
-                         blockSize)
-                (pBox, mapper);
-
-            KernelFillGapsLastFrame kernelFillGapsLastFrame;
-            __cudaKernel(kernelFillGapsLastFrame,
-                         alpaka::dim::DimInt<Dim>,
-                         mapper.getGridDim(),
-                         blockSize)
-                (pBox, mapper);
+            shiftSuperCells(mapper);
         }
         while (mapper.next());
 
         __setTransactionEvent(__endTransaction());
+        activeSuperCells.setDirty();
+    }
+
+    /* Shift all particles in CORE and BORDER
+     *
+     * Same as shiftParticles<CORE + BORDER>() but only supercells appended
+     * to mustShiftSuperCells by the push are visited. Particles are pushed
+     * from these supercells into their neighbors, gaps are only created in
+     * the visited supercells.
+     */
+    void shiftMarkedParticles()
+    {
+        mustShiftSuperCells.synchronize();
+
+        __startTransaction(__getTransactionEvent());
+        for (uint32_t stride = 0; stride < ShiftListType::NumStrides; ++stride)
+        {
+            typename ShiftListType::Mapping mapper(mustShiftSuperCells.getStrideMapping(stride));
+            if (mapper.getSize() != 0)
+                shiftSuperCells(mapper);
+        }
+        __setTransactionEvent(__endTransaction());
+
+        /* particles move at most into the neighbors of a shifted supercell */
+        for (uint32_t stride = 0; stride < ShiftListType::NumStrides; ++stride)
+            for (uint32_t i = 0; i < mustShiftSuperCells.getStrideSize(stride); ++i)
+                activeSuperCells.addNeighbors(mustShiftSuperCells.getHostSuperCell(stride, i));
+    }
 
+    /* Rebuild the list of supercells in CORE and BORDER which hold particles
+     *
+     * The occupied supercells are read back to the host, therefore this
+     * method waits for all previous operations of the transaction.
+     */
+    void updateActiveSuperCells()
+    {
+        AreaMapping<CORE + BORDER, MappingDesc> mapper(this->cellDescription);
+        const DataSpace<Dim> areaSize(mapper.getGridDim());
+        const int blockSize = ActiveSuperCellListType::BlockSize;
+        const int gridSize = (areaSize.productOfComponents() + blockSize - 1) / blockSize;
+
+        typename ActiveSuperCellListType::FlagBuffer& flags = activeSuperCells.getFlagBuffer();
+
+        KernelActiveSuperCells kernelActiveSuperCells;
+        __cudaKernel(
+            kernelActiveSuperCells,
+            alpaka::dim::DimInt<1u>,
+            static_cast<AlpakaIdxSize>(gridSize),
+            static_cast<AlpakaIdxSize>(blockSize))(
+                particlesBuffer->getDeviceParticleBox(),
+                flags.getDeviceBuffer().getDataBox(),
+                areaSize,
+                mapper);
+
+        flags.deviceToHost();
+        __getTransactionEvent().waitForFinished();
+        activeSuperCells.setFromFlags();
+        activeSuperCells.upload();
     }
 
     /* fill gaps in a AREA
@@ -118,7 +222,7 @@ protected:
         AreaMapping<AREA, MappingDesc> mapper(this->cellDescription);
 
         DataSpace<Dim> blockSize(DataSpace<Dim>::create(1));
-        blockSize.x() = static_cast<AlpakaIdxSize>(TileSize);
+        blockSize.x() = static_cast<AlpakaIdxSize>(FrameSize);
 
         KernelFillGaps kernelFillGaps;
         __cudaKernel(kernelFillGaps,
@@ -135,14 +239,77 @@ protected:
             (particlesBuffer->getDeviceParticleBox(), mapper);
     }
 
+    /* sort particles by cell and pack frames densely in a AREA
+     * @tparam AREA area which is used (CORE,BORDER,GUARD or a combination)
+     */
+    template<uint32_t AREA>
+    void sortParticles()
+    {
+        AreaMapping<AREA, MappingDesc> mapper(this->cellDescription);
+
+        DataSpace<Dim> blockSize(DataSpace<Dim>::create(1));
+        blockSize.x() = static_cast<AlpakaIdxSize>(FrameSize);
+
+        KernelSortParticles kernelSortParticles;
+        __cudaKernel(kernelSortParticles,
+                     alpaka::dim::DimInt<Dim>,
+                     mapper.getGridDim(),
+                     blockSize)
+            (particlesBuffer->getDeviceParticleBox(), mapper);
+    }
 
 public:
 
+    /* Get the stream of this species
+     *
+     * Use it with __startStreamTransaction to run the work of different
+     * species concurrently.
+     */
+    EventStream* getEventStream()
+    {
+        return eventStream;
+    }
+
+    EventTask getStreamEvent() const
+    {
+        return streamEvent;
+    }
+
+    void setStreamEvent(const EventTask& event)
+    {
+        streamEvent = event;
+    }
+
+    /* Get the list of supercells in CORE and BORDER which hold particles
+     *
+     * The list is rebuilt if particles were created since the last call or
+     * if too many supercells were added by moved particles, otherwise only
+     * the added supercells are uploaded.
+     */
+    ActiveSuperCellListType& getActiveSuperCells()
+    {
+        if (activeSuperCells.isDirty() || activeSuperCells.isOversized())
+            updateActiveSuperCells();
+        else if (activeSuperCells.isModified())
+            activeSuperCells.upload();
+        return activeSuperCells;
+    }
+
+    /* sort particles of each supercell by cell and release frames which
+     * are not needed after packing (CORE and BORDER)
+     */
+    void sortAllParticles()
+    {
+        this->sortParticles < CORE + BORDER > ();
+    }
+
     /* fill gaps in a the complete simulation area (include GUARD)
      */
     void fillAllGaps()
     {
         this->fillGaps < CORE + BORDER + GUARD > ();
+        /* fillAllGaps() finishes each creation of particles */
+        activeSuperCells.setDirty();
     }
 
     /* fill all gaps in the border of the simulation
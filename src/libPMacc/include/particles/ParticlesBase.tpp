@@ -40,7 +40,7 @@ namespace PMacc
 
         ExchangeMapping<GUARD, MappingDesc> mapper(this->cellDescription, exchangeType);
         DataSpace<Dim> blockSize(DataSpace<Dim>::create(1));
-        blockSize.x() = static_cast<AlpakaIdxSize>(TileSize);
+        blockSize.x() = static_cast<AlpakaIdxSize>(FrameSize);
 
         __cudaKernel(
             kernelDeleteParticles,
@@ -59,7 +59,7 @@ namespace PMacc
 
         AreaMapping<T_area, MappingDesc> mapper(this->cellDescription);
         DataSpace<Dim> blockSize(DataSpace<Dim>::create(1));
-        blockSize.x() = static_cast<AlpakaIdxSize>(TileSize);
+        blockSize.x() = static_cast<AlpakaIdxSize>(FrameSize);
 
         __cudaKernel(
             kernelDeleteParticles,
@@ -75,6 +75,7 @@ namespace PMacc
     {
         deleteParticlesInArea<CORE+BORDER+GUARD>();
         particlesBuffer->reset( );
+        activeSuperCells.setDirty();
     }
 
     template<typename T_ParticleDescription, class MappingDesc>
@@ -86,7 +87,7 @@ namespace PMacc
 
             ExchangeMapping<GUARD, MappingDesc> mapper(this->cellDescription, exchangeType);
             DataSpace<Dim> blockSize(DataSpace<Dim>::create(1));
-            blockSize.x() = static_cast<AlpakaIdxSize>(TileSize);
+            blockSize.x() = static_cast<AlpakaIdxSize>(FrameSize);
 
             particlesBuffer->getSendExchangeStack(exchangeType).setCurrentSize(0);
 
@@ -117,7 +118,7 @@ namespace PMacc
                     kernelInsertParticles,
                     alpaka::dim::DimInt<1u>,
                     static_cast<AlpakaIdxSize>(grid),
-                    static_cast<AlpakaIdxSize>(TileSize))(
+                    static_cast<AlpakaIdxSize>(FrameSize))(
                         particlesBuffer->getDeviceParticleBox(),
                         particlesBuffer->getReceiveExchangeStack(exchangeType).getDeviceExchangePopDataBox(),
                         mapper);
@@ -128,6 +129,18 @@ namespace PMacc
     template<typename T_ParticleDescription, class MappingDesc>
     EventTask ParticlesBase<T_ParticleDescription, MappingDesc>::asyncCommunication(EventTask event)
     {
+        if (particlesBuffer->isAdaptationRequired())
+        {
+            /* the exchange buffers are reallocated, no communication may be in flight */
+            Environment<>::get().Manager().waitForAllTasks();
+            particlesBuffer->adaptExchanges();
+        }
+
+        /* received particles are inserted into the border */
+        for (uint32_t i = 1; i < 27; ++i)
+            if (particlesBuffer->hasReceiveExchange(i))
+                activeSuperCells.addBorder(i);
+
         EventTask ret;
         __startTransaction(event);
         Environment<>::get().ParticleFactory().createTaskParticlesReceive(*this);
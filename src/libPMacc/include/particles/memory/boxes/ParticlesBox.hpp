@@ -78,10 +78,12 @@ public:
     /**
      * Returns an empty frame from data heap.
      *
-     * @return an empty frame
+     * The allocation is tried up to 13 times.
+     *
+     * @return pointer to an empty frame, NULL if all tries failed
      */
     PMACC_NO_NVCC_HDWARNING
-    DINLINE FRAME &getEmptyFrame() const
+    DINLINE FrameType* getEmptyFramePtr() const
     {
 
         FrameType* tmp = NULL;
@@ -92,25 +94,36 @@ public:
             if (tmp != NULL)
             {
                 /* disable all particles since we can not assume that newly allocated memory contains zeros */
-                for (int i = 0; i < (int) math::CT::volume<typename FrameType::SuperCellSize>::type::value; ++i)
+                for (int i = 0; i < (int) FrameType::FrameSize::value; ++i)
                     (*tmp)[i][multiMask_] = 0;
 #ifdef __CUDA_ARCH__
                 /* takes care that changed values are visible to all threads inside this block*/
                 __threadfence_block();
 #endif
-               // break;
+                break;
             }
             else
             {
                 printf("%s: mallocMC out of memory (try %i of %i)\n",
-                       (numTries+1)==maxTries?"WARNING":"ERROR",
+                       (numTries+1)==maxTries?"ERROR":"WARNING",
                        numTries+1,
                        maxTries);
 
             }
         }
 
-        return *(FramePtr(tmp));
+        return tmp;
+    }
+
+    /**
+     * Returns an empty frame from data heap.
+     *
+     * @return an empty frame
+     */
+    PMACC_NO_NVCC_HDWARNING
+    DINLINE FRAME &getEmptyFrame() const
+    {
+        return *(FramePtr(getEmptyFramePtr()));
     }
 
     /**
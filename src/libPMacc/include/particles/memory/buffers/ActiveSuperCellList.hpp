@@ -0,0 +1,310 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "dimensions/DataSpace.hpp"
+#include "dimensions/DataSpaceOperations.hpp"
+#include "mappings/kernel/AreaMapping.hpp"
+#include "mappings/kernel/ListMapping.hpp"
+#include "memory/buffers/GridBuffer.hpp"
+#include "memory/dataTypes/Mask.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace PMacc
+{
+
+/**
+ * Get the stride class of a supercell
+ *
+ * Supercells of the same class are at least three supercells apart in
+ * each dimension.
+ *
+ * @param superCellIdx supercell index including guard
+ * @return class in [0, 3^T_dim)
+ */
+template<unsigned T_dim>
+HDINLINE uint32_t getSuperCellStride(const DataSpace<T_dim>& superCellIdx)
+{
+    DataSpace<T_dim> strideIdx;
+    for (uint32_t d = 0; d < T_dim; ++d)
+        strideIdx[d] = superCellIdx[d] % 3;
+    return DataSpaceOperations<T_dim>::map(DataSpace<T_dim>::create(3), strideIdx);
+}
+
+/**
+ * Compact list of the supercells of CORE and BORDER which hold particles.
+ *
+ * The list is grouped by stride classes: two supercells of the same class
+ * are at least three supercells apart in each dimension, which is the
+ * condition StrideMapping<.., 3, ..> guarantees for kernels that write to
+ * neighboring supercells (shift, current deposition).
+ *
+ * The list is kept on the host and uploaded if it was changed. It is
+ * rebuilt from the particle data by ParticlesBase::updateActiveSuperCells()
+ * if it is dirty. Between two rebuilds the operations which move particles
+ * add the supercells which can receive particles (the neighbors of shifted
+ * supercells, the border of received exchanges), thus the list can contain
+ * supercells which became empty. Kernels launched with the list must
+ * handle empty supercells.
+ *
+ * @tparam MappingDesc mapping description of the simulation
+ */
+template<class MappingDesc>
+class ActiveSuperCellList
+{
+public:
+
+    enum
+    {
+        Dim = MappingDesc::Dim,
+        /* number of stride classes (3^Dim) */
+        NumStrides = Dim == DIM3 ? 27 : 9,
+        /* threads per block of the kernel which marks occupied supercells */
+        BlockSize = 256
+    };
+
+    typedef ListMapping<MappingDesc> Mapping;
+    typedef GridBuffer<DataSpace<Dim>, DIM1> IndexBuffer;
+    typedef GridBuffer<uint32_t, DIM1> FlagBuffer;
+
+    ActiveSuperCellList(MappingDesc description) :
+    cellDescription(description), borderExchanges(0), size(0), numMembers(0),
+    rebuildSize(0), dirty(true), modified(false)
+    {
+        AreaMapping<CORE + BORDER, MappingDesc> mapper(description);
+        areaSize = mapper.getGridDim();
+        guardSuperCells = DataSpace<Dim>::create(description.getGuardingSuperCells());
+        const int capacity = areaSize.productOfComponents();
+
+        indices.reset(new IndexBuffer(DataSpace<DIM1>(capacity)));
+        flags.reset(new FlagBuffer(DataSpace<DIM1>(capacity)));
+        isMember.resize(capacity, 0);
+
+        for (uint32_t i = 0; i < NumStrides; ++i)
+        {
+            strideOffsets[i] = 0;
+            strideSizes[i] = 0;
+        }
+    }
+
+    /* mapping over all active supercells */
+    Mapping getMapping()
+    {
+        return Mapping(cellDescription, indices->getDeviceBuffer().getDataBox(), 0, size);
+    }
+
+    /**
+     * Get a mapping over all active supercells of one stride class
+     *
+     * @param stride stride class, in [0, NumStrides)
+     */
+    Mapping getStrideMapping(uint32_t stride)
+    {
+        return Mapping(cellDescription,
+                       indices->getDeviceBuffer().getDataBox(),
+                       strideOffsets[stride],
+                       strideSizes[stride]);
+    }
+
+    /* number of active supercells */
+    uint32_t getSize() const
+    {
+        return size;
+    }
+
+    bool isDirty() const
+    {
+        return dirty;
+    }
+
+    /* mark the list as outdated, it is rebuilt before the next use */
+    void setDirty()
+    {
+        dirty = true;
+    }
+
+    /* true if supercells were added since the last upload */
+    bool isModified() const
+    {
+        return modified;
+    }
+
+    /**
+     * Returns true if the list grew by more than a quarter since the last
+     * rebuild, a rebuild removes the supercells which became empty.
+     */
+    bool isOversized() const
+    {
+        return numMembers * 4 > rebuildSize * 5 + 4;
+    }
+
+    /* one flag per supercell of CORE and BORDER, set if it holds particles */
+    FlagBuffer& getFlagBuffer()
+    {
+        return *flags;
+    }
+
+    /**
+     * Add a supercell to the list
+     *
+     * Supercells outside of CORE and BORDER and supercells which are
+     * already part of the list are ignored.
+     *
+     * @param superCellIdx supercell index including guard
+     */
+    void add(const DataSpace<Dim>& superCellIdx)
+    {
+        const DataSpace<Dim> areaIdx(superCellIdx - guardSuperCells);
+        for (uint32_t d = 0; d < Dim; ++d)
+            if (areaIdx[d] < 0 || areaIdx[d] >= areaSize[d])
+                return;
+        const int linearIdx = DataSpaceOperations<Dim>::map(areaSize, areaIdx);
+        if (isMember[linearIdx])
+            return;
+        isMember[linearIdx] = 1;
+        strideLists[getSuperCellStride(superCellIdx)].push_back(superCellIdx);
+        ++numMembers;
+        modified = true;
+    }
+
+    /**
+     * Add a supercell and all its neighbors to the list
+     *
+     * @param superCellIdx supercell index including guard
+     */
+    void addNeighbors(const DataSpace<Dim>& superCellIdx)
+    {
+        const DataSpace<Dim> three(DataSpace<Dim>::create(3));
+        for (int i = 0; i < three.productOfComponents(); ++i)
+            add(superCellIdx + DataSpaceOperations<Dim>::map(three, i) - DataSpace<Dim>::create(1));
+    }
+
+    /**
+     * Add the border supercells into which particles of an exchange are
+     * inserted
+     *
+     * The border stays part of the list, also after a rebuild.
+     *
+     * @param exchangeType direction of the exchange
+     */
+    void addBorder(uint32_t exchangeType)
+    {
+        if (borderExchanges & (1u << exchangeType))
+            return;
+        borderExchanges |= 1u << exchangeType;
+        addBorderSuperCells(exchangeType);
+    }
+
+    /**
+     * Replace the list by all supercells with a set flag
+     *
+     * The flags must be copied to the host before.
+     */
+    void setFromFlags()
+    {
+        typename FlagBuffer::DataBoxType hostBox = flags->getHostBuffer().getDataBox();
+        std::fill(isMember.begin(), isMember.end(), 0);
+        for (uint32_t i = 0; i < NumStrides; ++i)
+            strideLists[i].clear();
+        numMembers = 0;
+
+        for (int i = 0; i < areaSize.productOfComponents(); ++i)
+            if (hostBox[i] != 0)
+                add(DataSpaceOperations<Dim>::map(areaSize, i) + guardSuperCells);
+        for (uint32_t ex = 1; ex < 27; ++ex)
+            if (borderExchanges & (1u << ex))
+                addBorderSuperCells(ex);
+
+        rebuildSize = numMembers;
+        dirty = false;
+        modified = true;
+    }
+
+    /**
+     * Copy the list to the device
+     *
+     * The supercells are stored ordered by stride class.
+     */
+    void upload()
+    {
+        typename IndexBuffer::DataBoxType hostBox = indices->getHostBuffer().getDataBox();
+        size = 0;
+        for (uint32_t i = 0; i < NumStrides; ++i)
+        {
+            strideOffsets[i] = size;
+            strideSizes[i] = strideLists[i].size();
+            for (uint32_t j = 0; j < strideSizes[i]; ++j)
+                hostBox[size + j] = strideLists[i][j];
+            size += strideSizes[i];
+        }
+        indices->hostToDevice();
+        modified = false;
+    }
+
+private:
+
+    /* add all supercells of the border side of an exchange */
+    void addBorderSuperCells(uint32_t exchangeType)
+    {
+        const DataSpace<Dim> direction(Mask::getRelativeDirections<Dim>(exchangeType));
+        DataSpace<Dim> begin;
+        DataSpace<Dim> faceSize;
+        for (uint32_t d = 0; d < Dim; ++d)
+        {
+            begin[d] = direction[d] == 1 ? areaSize[d] - 1 : 0;
+            faceSize[d] = direction[d] == 0 ? areaSize[d] : 1;
+        }
+        for (int i = 0; i < faceSize.productOfComponents(); ++i)
+            add(begin + DataSpaceOperations<Dim>::map(faceSize, i) + guardSuperCells);
+    }
+
+    MappingDesc cellDescription;
+    /* supercells of CORE and BORDER */
+    DataSpace<Dim> areaSize;
+    DataSpace<Dim> guardSuperCells;
+
+    std::unique_ptr<IndexBuffer> indices;
+    std::unique_ptr<FlagBuffer> flags;
+
+    /* host side list, one flag per supercell of CORE and BORDER */
+    std::vector<char> isMember;
+    std::vector<DataSpace<Dim> > strideLists[NumStrides];
+    /* bit i is set if the border of exchange i is part of the list */
+    uint32_t borderExchanges;
+
+    uint32_t strideOffsets[NumStrides];
+    uint32_t strideSizes[NumStrides];
+    /* number of uploaded supercells */
+    uint32_t size;
+    uint32_t numMembers;
+    /* number of supercells after the last rebuild */
+    uint32_t rebuildSize;
+    bool dirty;
+    bool modified;
+};
+
+} //namespace PMacc
@@ -30,6 +30,9 @@
 #include "particles/memory/buffers/StackExchangeBuffer.hpp"
 #include "eventSystem/EventSystem.hpp"
 #include "particles/memory/dataTypes/SuperCell.hpp"
+#include "mpi/MPIReduce.hpp"
+#include "nvidia/functors/Max.hpp"
+#include "debug/VerboseLog.hpp"
 
 #include "math/Vector.hpp"
 
@@ -39,6 +42,7 @@
 
 #include <boost/mpl/vector.hpp>
 #include <boost/mpl/copy.hpp>
+#include <algorithm>
 #include <boost/mpl/back_inserter.hpp>
 
 #include "particles/memory/frames/Frame.hpp"
@@ -114,7 +118,7 @@ public:
     ParticleDescriptionDefault;
 
     typedef Frame<
-    OperatorCreatePairStaticArray<PMacc::math::CT::volume<SuperCellSize>::type::value >, ParticleDescriptionDefault> ParticleType;
+    OperatorCreatePairStaticArray<T_ParticleDescription::FrameSize::value >, ParticleDescriptionDefault> ParticleType;
 
     typedef
     typename ReplaceValueTypeSeq<T_ParticleDescription, border_particleList>::type
@@ -134,6 +138,17 @@ private:
         SizeOfOneBorderElement = (sizeof (ParticleTypeBorder) + sizeof (PopPushType))
     };
 
+    /* parameters of the exchange buffer adaptation */
+    enum
+    {
+        /* number of communications between two adaptations */
+        AdaptationPeriod = 100,
+        /* exchange buffers never grow larger than the initial size times this factor */
+        MaxGrowFactor = 16,
+        /* exchange buffers never shrink below the initial size divided by this factor */
+        MaxShrinkFactor = 64
+    };
+
 public:
 
     /**
@@ -144,8 +159,14 @@ public:
      * @param gpuMemory how many memory on device is used for this instance (in byte)
      */
     ParticlesBuffer(DataSpace<DIM> layout, DataSpace<DIM> superCellSize) :
-    superCellSize(superCellSize), gridSize(layout), framesExchanges(NULL)
+    superCellSize(superCellSize), gridSize(layout), framesExchanges(NULL), communicationCount(0)
     {
+        for (uint32_t i = 0; i < 27; ++i)
+        {
+            initialCapacity[i] = 0;
+            capacity[i] = 0;
+            sendTraffic[i] = 0;
+        }
 
         exchangeMemoryIndexer = new GridBuffer<PopPushType, DIM1 > (DataSpace<DIM1 > (1));
         framesExchanges = new GridBuffer< ParticleType, DIM1, ParticleTypeBorder > (DataSpace<DIM1 > (1));
@@ -196,6 +217,80 @@ public:
         framesExchanges->addExchangeBuffer(receive, DataSpace<DIM1 > (numBorderFrames), communicationTag, true);
 
         exchangeMemoryIndexer->addExchangeBuffer(receive, DataSpace<DIM1 > (numBorderFrames), communicationTag | (1u << (20 - 5)), true);
+
+        /* GridBuffer creates no exchange with zero elements */
+        if (numBorderFrames == 0)
+            return;
+
+        const Mask send = receive.getMirroredMask();
+        for (uint32_t ex = 1; ex < 27; ++ex)
+        {
+            if (send.isSet(ex))
+            {
+                initialCapacity[ex] = numBorderFrames;
+                capacity[ex] = numBorderFrames;
+            }
+        }
+    }
+
+    /**
+     * Record the number of particles sent in one communication.
+     *
+     * @param ex send direction
+     * @param numParticles particles sent over all rounds of the communication
+     */
+    void addSendTraffic(uint32_t ex, size_t numParticles)
+    {
+        sendTraffic[ex] = std::max(sendTraffic[ex], (uint64_cu) numParticles);
+    }
+
+    /**
+     * Count a communication and check if the exchange buffers must be adapted.
+     *
+     * @return true every AdaptationPeriod communications
+     */
+    bool isAdaptationRequired()
+    {
+        return (++communicationCount % AdaptationPeriod) == 0;
+    }
+
+    /**
+     * Resize the exchange buffers to the observed traffic.
+     *
+     * A direction where the peak traffic of the last period did not fit in
+     * one round grows to twice its size (or 1.5 times the peak). A direction
+     * where the peak used less than a quarter shrinks to twice the peak.
+     * The gap between both thresholds avoids oscillation.
+     *
+     * The peak traffic is reduced over all ranks, therefore the sender and
+     * the receiver of each link select the same size, also after the
+     * neighbors changed because of a slide of the moving window.
+     * Must be called collectively by all ranks while no particle
+     * communication is in flight.
+     */
+    void adaptExchanges()
+    {
+        uint64_cu globalTraffic[27];
+        mpiReduce(nvidia::functors::Max(), globalTraffic, sendTraffic, 27, mpi::reduceMethods::AllReduce());
+
+        for (uint32_t ex = 1; ex < 27; ++ex)
+        {
+            sendTraffic[ex] = 0;
+            if (capacity[ex] == 0)
+                continue;
+
+            const size_t newCapacity = getAdaptedCapacity(ex, globalTraffic[ex]);
+            if (newCapacity == capacity[ex])
+                continue;
+
+            log<ggLog::MEMORY > ("particle exchange %1%: resize from %2% to %3% particles (peak %4% particles, %5% MiB)") %
+                ex % capacity[ex] % newCapacity % globalTraffic[ex] %
+                ((double) (newCapacity * SizeOfOneBorderElement) / 1024. / 1024.);
+
+            framesExchanges->resizeExchangeBuffer(ex, DataSpace<DIM1 > (newCapacity), true);
+            exchangeMemoryIndexer->resizeExchangeBuffer(ex, DataSpace<DIM1 > (newCapacity), true);
+            capacity[ex] = newCapacity;
+        }
     }
 
     /**
@@ -344,5 +439,27 @@ private:
     DataSpace<DIM> superCellSize;
     DataSpace<DIM> gridSize;
 
+    /* capacity per send direction in particles, 0 if the direction has no exchange */
+    size_t initialCapacity[27];
+    size_t capacity[27];
+    /* peak number of sent particles per direction since the last adaptation */
+    uint64_cu sendTraffic[27];
+    uint32_t communicationCount;
+    mpi::MPIReduce mpiReduce;
+
+    size_t getAdaptedCapacity(uint32_t ex, uint64_cu peak) const
+    {
+        const size_t minCapacity = std::max(initialCapacity[ex] / MaxShrinkFactor, (size_t) 1u);
+        const size_t maxCapacity = initialCapacity[ex] * MaxGrowFactor;
+
+        size_t newCapacity = capacity[ex];
+        if (peak >= capacity[ex])
+            newCapacity = std::max(capacity[ex] * 2u, (size_t) (peak + peak / 2u));
+        else if (peak * 4u < capacity[ex])
+            newCapacity = (size_t) peak * 2u;
+
+        return std::min(std::max(newCapacity, minCapacity), maxCapacity);
+    }
+
 };
 }
@@ -0,0 +1,188 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "dimensions/DataSpace.hpp"
+#include "mappings/kernel/AreaMapping.hpp"
+#include "mappings/kernel/ListMapping.hpp"
+#include "memory/buffers/GridBuffer.hpp"
+#include "particles/memory/buffers/ActiveSuperCellList.hpp"
+
+#include <memory>
+
+namespace PMacc
+{
+
+/**
+ * Device side view of a SuperCellWorkList
+ *
+ * Kernels append supercells with append(), each stride class is written to
+ * its own segment of the index buffer.
+ */
+template<typename T_IndexBox, typename T_CounterBox, unsigned T_dim>
+struct SuperCellWorkListBox
+{
+    T_IndexBox indices;
+    T_CounterBox counter;
+    /* maximum number of supercells of one stride class */
+    uint32_t segmentSize;
+
+    /**
+     * Append a supercell to the list
+     *
+     * Must be called at most once per supercell and kernel call.
+     *
+     * @param superCellIdx supercell index including guard
+     */
+    template<typename T_Acc>
+    DINLINE void append(T_Acc const & acc, const DataSpace<T_dim>& superCellIdx) const
+    {
+        const uint32_t stride = getSuperCellStride(superCellIdx);
+        const uint32_t position = alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &(counter[stride]), 1u);
+        indices[stride * segmentSize + position] = superCellIdx;
+    }
+};
+
+/**
+ * List of supercells of CORE and BORDER which is filled by kernels
+ *
+ * In contrast to ActiveSuperCellList the list is not built from the
+ * particle data but appended during a kernel, e.g. the particle push
+ * appends all supercells from which particles leave. The list is grouped
+ * by the stride classes of ActiveSuperCellList, each class has a fixed
+ * segment, therefore appending needs only one atomic operation.
+ *
+ * @tparam MappingDesc mapping description of the simulation
+ */
+template<class MappingDesc>
+class SuperCellWorkList
+{
+public:
+
+    enum
+    {
+        Dim = MappingDesc::Dim,
+        NumStrides = ActiveSuperCellList<MappingDesc>::NumStrides
+    };
+
+    typedef ListMapping<MappingDesc> Mapping;
+    typedef GridBuffer<DataSpace<Dim>, DIM1> IndexBuffer;
+    typedef GridBuffer<uint32_t, DIM1> CounterBuffer;
+    typedef SuperCellWorkListBox<
+        typename IndexBuffer::DataBoxType,
+        typename CounterBuffer::DataBoxType,
+        Dim> DataBoxType;
+
+    SuperCellWorkList(MappingDesc description) :
+    cellDescription(description), segmentSize(1)
+    {
+        AreaMapping<CORE + BORDER, MappingDesc> mapper(description);
+        const DataSpace<Dim> areaSize(mapper.getGridDim());
+        /* at most every third supercell per dimension belongs to a class */
+        for (uint32_t d = 0; d < Dim; ++d)
+            segmentSize *= (areaSize[d] + 2) / 3;
+
+        indices.reset(new IndexBuffer(DataSpace<DIM1>(segmentSize * NumStrides)));
+        counters.reset(new CounterBuffer(DataSpace<DIM1>(NumStrides)));
+
+        for (uint32_t i = 0; i < NumStrides; ++i)
+            strideSizes[i] = 0;
+    }
+
+    /* remove all supercells from the list */
+    void clear()
+    {
+        counters->getDeviceBuffer().setValue(0);
+    }
+
+    DataBoxType getDeviceDataBox()
+    {
+        DataBoxType box;
+        box.indices = indices->getDeviceBuffer().getDataBox();
+        box.counter = counters->getDeviceBuffer().getDataBox();
+        box.segmentSize = segmentSize;
+        return box;
+    }
+
+    /**
+     * Copy the list and the number of supercells per stride class to the
+     * host
+     *
+     * Waits for all previous operations of the transaction.
+     */
+    void synchronize()
+    {
+        indices->deviceToHost();
+        counters->deviceToHost();
+        __getTransactionEvent().waitForFinished();
+
+        typename CounterBuffer::DataBoxType hostBox = counters->getHostBuffer().getDataBox();
+        for (uint32_t i = 0; i < NumStrides; ++i)
+            strideSizes[i] = hostBox[i];
+    }
+
+    /**
+     * Get a mapping over all supercells of one stride class
+     *
+     * The sizes are valid after synchronize().
+     *
+     * @param stride stride class, in [0, NumStrides)
+     */
+    Mapping getStrideMapping(uint32_t stride)
+    {
+        return Mapping(cellDescription,
+                       indices->getDeviceBuffer().getDataBox(),
+                       stride * segmentSize,
+                       strideSizes[stride]);
+    }
+
+    /* number of supercells of a stride class, valid after synchronize() */
+    uint32_t getStrideSize(uint32_t stride) const
+    {
+        return strideSizes[stride];
+    }
+
+    /**
+     * Get a supercell of the host copy of the list
+     *
+     * @param stride stride class, in [0, NumStrides)
+     * @param i position in the stride class, in [0, getStrideSize(stride))
+     * @return supercell index including guard
+     */
+    DataSpace<Dim> getHostSuperCell(uint32_t stride, uint32_t i)
+    {
+        return indices->getHostBuffer().getDataBox()[stride * segmentSize + i];
+    }
+
+private:
+    MappingDesc cellDescription;
+
+    std::unique_ptr<IndexBuffer> indices;
+    std::unique_ptr<CounterBuffer> counters;
+
+    uint32_t segmentSize;
+    uint32_t strideSizes[NumStrides];
+};
+
+} //namespace PMacc
@@ -86,6 +86,8 @@ public InheritLinearly<
     typedef typename ParticleDescription::MethodsList MethodsList;
     typedef typename ParticleDescription::FlagsList FlagList;
     typedef typename ParticleDescription::FrameExtensionList FrameExtensionList;
+    /* number of particles in a frame of a particle buffer */
+    typedef typename ParticleDescription::FrameSize FrameSize;
     typedef Frame<T_CreatePairOperator, ParticleDescription> ThisType;
     /* definition of the MapTupel where we inherit from*/
     typedef pmath::MapTuple<typename SeqToMap<ValueTypeSeq, T_CreatePairOperator>::type, pmath::AlignedData> BaseType;
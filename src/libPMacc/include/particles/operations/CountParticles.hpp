@@ -66,6 +66,7 @@ ALPAKA_FN_ACC void operator()(
     typedef typename Mapping::SuperCellSize SuperCellSize;
 
     const int linearThreadIdx = DataSpaceOperations<Dim>::template map<SuperCellSize > (threadIndex);
+    const int cellsPerSuperCell = math::CT::volume<SuperCellSize>::type::value;
     const DataSpace<Dim> superCellIdx(mapper.getSuperCellIndex(DataSpace<Dim > (blockIndex)));
 
     if (linearThreadIdx == 0)
@@ -80,16 +81,17 @@ ALPAKA_FN_ACC void operator()(
     filter.setSuperCellPosition((superCellIdx - mapper.getGuardingSuperCells()) * mapper.getSuperCellSize());
     while (isValid)
     {
-        if (linearThreadIdx < particlesInSuperCell)
+        /* a frame can hold more or less particles than cells in a supercell */
+        for (int particleIdx = linearThreadIdx; particleIdx < particlesInSuperCell; particleIdx += cellsPerSuperCell)
         {
-            if (filter(*frame, linearThreadIdx))
+            if (filter(*frame, particleIdx))
                 alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &counter, 1);
         }
         alpaka::block::sync::syncBlockThreads(acc);
         if (linearThreadIdx == 0)
         {
             frame = &(pb.getPreviousFrame(*frame, isValid));
-            particlesInSuperCell = math::CT::volume<SuperCellSize>::type::value;
+            particlesInSuperCell = FRAME::FrameSize::value;
         }
         alpaka::block::sync::syncBlockThreads(acc);
     }
@@ -44,7 +44,7 @@ namespace PMacc
         state(Constructor),
         maxSize(parBase.getParticlesBuffer().getSendExchangeStack(exchange).getMaxParticlesCount()),
         initDependency(__getTransactionEvent()),
-        lastSize(0),lastSendEvent(EventTask()){ }
+        lastSize(0),totalSize(0),lastSendEvent(EventTask()){ }
 
         virtual void init()
         {
@@ -71,6 +71,7 @@ namespace PMacc
                         //bash is finished
                         __startTransaction();
                         lastSize = parBase.getParticlesBuffer().getSendExchangeStack(exchange).getDeviceParticlesCurrentSize();
+                        totalSize += lastSize;
                        // std::cout<<"bsend = "<<parBase.getParticlesBuffer().getSendExchangeStack(exchange).getDeviceCurrentSize()<<std::endl;
                         lastSendEvent = parBase.getParticlesBuffer().asyncSendParticles(EventTask(), exchange, tmpEvent);
                         __endTransaction();
@@ -98,6 +99,7 @@ namespace PMacc
                 case WaitForSendEnd:
                     if (NULL == Environment<>::get().Manager().getITaskIfNotFinished(lastSendEvent.getTaskId()))
                     {
+                        parBase.getParticlesBuffer().addSendTraffic(exchange, totalSize);
                         state = Finished;
                         return true;
                     }
@@ -146,6 +148,8 @@ namespace PMacc
         uint32_t exchange;
         size_t maxSize;
         size_t lastSize;
+        /* particles sent over all rounds */
+        size_t totalSize;
     };
 
 } //namespace PMacc
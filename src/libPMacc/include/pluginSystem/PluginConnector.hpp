@@ -24,6 +24,8 @@
 
 #include "pluginSystem/INotify.hpp"
 #include "pluginSystem/IPlugin.hpp"
+#include "eventSystem/profiling/ProfileRegistry.hpp"
+#include "simulationControl/TimeInterval.hpp"
 
 #include <list>
 
@@ -128,6 +130,23 @@ namespace PMacc
                 throw PluginException("Notifications for a NULL object are not allowed.");
         }
 
+        /**
+         * Check if any plugin is notified in a step.
+         *
+         * @param currentStep current simulation iteration step
+         * @return true if notifyPlugins() notifies at least one plugin
+         */
+        bool hasNotifications(uint32_t currentStep) const
+        {
+            for (NotificationList::const_iterator iter = notificationList.begin();
+                    iter != notificationList.end(); ++iter)
+            {
+                if (currentStep % iter->second == 0)
+                    return true;
+            }
+            return false;
+        }
+
         /**
          * Notifies plugins that data should be dumped.
          *
@@ -142,8 +161,19 @@ namespace PMacc
                 uint32_t period = iter->second;
                 if (currentStep % period == 0)
                 {
+                    ProfileRegistry& registry = ProfileRegistry::getInstance();
+                    const double start = registry.isEnabled() ? TimeIntervall::getTime() : 0.0;
+
                     notifiedObj->notify(currentStep);
                     notifiedObj->setLastNotify(currentStep);
+
+                    if (registry.isEnabled())
+                    {
+                        IPlugin* plugin = dynamic_cast<IPlugin*>(notifiedObj);
+                        registry.addSample(
+                            std::string("notify ") + (plugin != NULL ? plugin->pluginGetName() : "unnamed"),
+                            0, TimeIntervall::getTime() - start);
+                    }
                 }
             }
         }
@@ -34,6 +34,10 @@
 #include "TimeInterval.hpp"
 
 #include "dataManagement/DataConnector.hpp"
+#include "eventSystem/EventSystem.hpp"
+#include "eventSystem/tuning/WorkDivTuner.hpp"
+#include "eventSystem/profiling/ProfileRegistry.hpp"
+#include "memory/NumaPlacement.hpp"
 
 
 #include "pluginSystem/IPlugin.hpp"
@@ -67,6 +71,9 @@ public:
     restartStep(-1),
     restartDirectory("checkpoints"),
     restartRequested(false),
+    replayTaskGraph(false),
+    autotune(false),
+    profile(false),
     CHECKPOINT_MASTER_FILE("checkpoints.txt")
     {
         tSimulation.toggleStart();
@@ -120,6 +127,9 @@ public:
     {
         Environment<DIM>::get().DataConnector().invalidate();
 
+        /* plugins copy data to the host, asynchronous CPU streams must be done */
+        Environment<>::get().StreamController().waitForAllStreams();
+
         /* trigger notification */
         Environment<DIM>::get().PluginConnector().notifyPlugins(currentStep);
 
@@ -183,6 +193,25 @@ public:
             roundAvg = 0.0; //clear round avg timer
         }
 
+        if (progress && (currentStep % showProgressAnyStep) == 0)
+        {
+            /* scheduler overhead of the event system since the last output */
+            Manager& manager = Environment<>::get().Manager();
+            const Manager::Statistics& stats = manager.getStatistics();
+            const double steps = (double) showProgressAnyStep;
+            log<ggLog::INFO > ("event system per step: %1% task polls, %2% MPI tests, %3% finished tasks, %4% sweeps") %
+                ((double) stats.taskPolls / steps) % ((double) stats.mpiTests / steps) %
+                ((double) stats.finishedTasks / steps) % ((double) stats.sweeps / steps);
+            manager.resetStatistics();
+
+            /* in steady state all tasks are taken from the pool */
+            TaskPool& taskPool = TaskPool::getInstance();
+            log<ggLog::MEMORY > ("task pool per step: %1% task allocations, %2% heap allocations") %
+                ((double) taskPool.getStatistics().allocations / steps) %
+                ((double) taskPool.getStatistics().heapAllocations / steps);
+            taskPool.resetStatistics();
+        }
+
     }
 
     /**
@@ -192,6 +221,7 @@ public:
     {
         uint32_t currentStep = init();
         tInit.toggleEnd();
+        NumaPlacement::getInstance().report();
         if (output)
         {
             std::cout << "initialization time: " << tInit.printInterval() <<
@@ -220,8 +250,13 @@ public:
 
         /* dump 0% output */
         dumpTimes(tSimCalculation, tRound, roundAvg, currentStep);
+        TransactionManager& transactionManager = Environment<>::get().TransactionManager();
+        transactionManager.setReplayEnabled(replayTaskGraph);
         while (currentStep < runSteps)
         {
+            /* capture the task graph of a full iteration, steps with a
+             * slide or plugin output create a different graph */
+            transactionManager.startCapture();
             tRound.toggleStart();
             runOneStep(currentStep);
             tRound.toggleEnd();
@@ -234,10 +269,17 @@ public:
             movingWindowCheck(currentStep);
             /*dump after simulated step*/
             dumpOneStep(currentStep);
+            transactionManager.endCapture();
         }
+        transactionManager.setReplayEnabled(false);
+
+        /* the ranks tune independently, the cache keeps the winners of rank 0 */
+        if (output)
+            WorkDivTuner::getInstance().store();
 
         //simulatation end
         Environment<>::get().Manager().waitForAllTasks();
+        Environment<>::get().StreamController().waitForAllStreams();
 
         tSimCalculation.toggleEnd();
 
@@ -248,6 +290,13 @@ public:
                 (int) (tSimCalculation.getInterval() / 1000.) << " sec" << std::endl;
         }
 
+        if (output && profile)
+        {
+            std::cout << "profile of rank 0:" << std::endl <<
+                ProfileRegistry::getInstance().getReport();
+            std::cout.flush();
+        }
+
     }
 
     virtual void pluginRegisterHelp(po::options_description& desc)
@@ -262,7 +311,16 @@ public:
             ("restart-step", po::value<int32_t>(&restartStep), "Checkpoint step to restart from")
             ("checkpoints", po::value<uint32_t>(&checkpointPeriod), "Period for checkpoint creation")
             ("checkpoint-directory", po::value<std::string>(&checkpointDirectory)->default_value(checkpointDirectory),
-             "Directory for checkpoints");
+             "Directory for checkpoints")
+            ("replay", po::value<bool>(&replayTaskGraph)->zero_tokens(),
+             "Post the MPI receives of the next step in advance while steps create the same task graph")
+            ("autotune", po::value<bool>(&autotune)->zero_tokens(),
+             "Measure the work division of kernels with a free block size during the first launches")
+            ("autotune-cache", po::value<std::string>(&autotuneCacheFile),
+             "File to load and store the work divisions selected by --autotune")
+            ("profile", po::value<bool>(&profile)->zero_tokens(),
+             "Time kernels, MPI tasks and plugins and print a profile at the end of the simulation "
+             "(kernels are synchronized after each launch)");
     }
 
     std::string pluginGetName() const
@@ -275,6 +333,13 @@ public:
         calcProgress();
 
         output = (getGridController().getGlobalRank() == 0);
+
+        WorkDivTuner& tuner = WorkDivTuner::getInstance();
+        tuner.setEnabled(autotune);
+        if (autotune && !autotuneCacheFile.empty())
+            tuner.setCacheFile(autotuneCacheFile);
+
+        ProfileRegistry::getInstance().setEnabled(profile);
     }
 
     void pluginUnload()
@@ -311,6 +376,18 @@ protected:
     /* restart requested */
     bool restartRequested;
 
+    /* replay the captured task graph of identical steps */
+    bool replayTaskGraph;
+
+    /* select the work division of tunable kernels by measurement */
+    bool autotune;
+
+    /* cache file for the work divisions selected by the tuner */
+    std::string autotuneCacheFile;
+
+    /* time kernels, MPI tasks and plugins and print a profile at the end */
+    bool profile;
+
     /* filename for checkpoint master file with all checkpoint timesteps */
     const std::string CHECKPOINT_MASTER_FILE;
 
@@ -48,15 +48,50 @@ namespace PMacc
     #define PMACC_ACC_CPU
 #endif
 
+#ifndef PMACC_CPU_ASYNC_STREAM
+    #define PMACC_CPU_ASYNC_STREAM 0
+#endif
+
+#ifndef PMACC_CPU_SUPERCELL_PER_THREAD
+    #define PMACC_CPU_SUPERCELL_PER_THREAD 0
+#endif
+
+#ifndef PMACC_CPU_FIRST_TOUCH
+    #define PMACC_CPU_FIRST_TOUCH 0
+#endif
+
+/* shift particles between supercells with KernelShiftParticlesScan */
+#ifndef PMACC_SHIFT_PREFIX_SUM
+    #define PMACC_SHIFT_PREFIX_SUM 0
+#endif
+
     using AlpakaHostDev = alpaka::dev::DevCpu;
 #ifdef PMACC_ACC_CPU
     using AlpakaAccDev = alpaka::dev::DevCpu;
-    //using AlpakaAccStream = alpaka::stream::StreamCpuAsync;
+#if (PMACC_CPU_ASYNC_STREAM == 1)
+    /* each stream owns a worker thread, the host thread returns immediately
+     * after a kernel is enqueued and can progress the event system (e.g. MPI)
+     */
+    using AlpakaAccStream = alpaka::stream::StreamCpuAsync;
+#else
     using AlpakaAccStream = alpaka::stream::StreamCpuSync;
+#endif
     template<
         typename TDim>
     using AlpakaAcc = alpaka::acc::AccCpuOmp2Threads<TDim, AlpakaIdxSize>;
+#if (PMACC_CPU_SUPERCELL_PER_THREAD == 1)
+    /* one thread per block, the cells of a supercell are the elements of
+     * this thread and OpenMP is used to distribute the supercells
+     */
+    #define PMACC_SUPERCELL_PER_THREAD 1
+    template<
+        typename TDim>
+    using AlpakaSuperCellAcc = alpaka::acc::AccCpuOmp2Blocks<TDim, AlpakaIdxSize>;
+#endif
 #else
+    /* device memory is not placed by the host threads */
+    #undef PMACC_CPU_FIRST_TOUCH
+    #define PMACC_CPU_FIRST_TOUCH 0
     using AlpakaAccDev = alpaka::dev::DevCudaRt;
     using AlpakaAccStream = alpaka::stream::StreamCudaRtAsync;
     template<
@@ -65,6 +100,14 @@ namespace PMacc
     using AlpakaAcc = alpaka::acc::AccGpuCudaRt<TDim, AlpakaIdxSize>;
 #endif
 
+#ifndef PMACC_SUPERCELL_PER_THREAD
+    #define PMACC_SUPERCELL_PER_THREAD 0
+    /* accelerator for kernels with one thread per cell of a supercell */
+    template<
+        typename TDim>
+    using AlpakaSuperCellAcc = AlpakaAcc<TDim>;
+#endif
+
 namespace bmpl = boost::mpl;
 namespace bfs = boost::filesystem;
 
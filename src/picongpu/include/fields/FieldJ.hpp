@@ -124,6 +124,11 @@ public:
 
 private:
 
+    /* launch the current deposition kernels with workerMultiplier times
+     * more threads than cells in a supercell */
+    template<int workerMultiplier, uint32_t AREA, class ParticlesClass>
+    void launchComputeCurrent(ParticlesClass &parClass);
+
     GridBuffer<ValueType, simDim> fieldJ;
     GridBuffer<ValueType, simDim>* fieldJrecv;
 
@@ -22,6 +22,8 @@
 #pragma once
 
 #include <iostream>
+#include <sstream>
+#include <vector>
 #include "simulation_defines.hpp"
 #include "FieldJ.hpp"
 #include "fields/FieldJ.kernel"
@@ -42,8 +44,11 @@
 
 #include <boost/mpl/accumulate.hpp>
 #include "particles/traits/GetCurrentSolver.hpp"
+#include "particles/traits/GetPushPeriod.hpp"
 #include "traits/GetMargin.hpp"
 #include "traits/Resolve.hpp"
+#include "eventSystem/tuning/WorkDivTuner.hpp"
+#include "simulationControl/TimeInterval.hpp"
 
 
 namespace picongpu
@@ -70,17 +75,28 @@ fieldJ( cellDescription.getGridLayout( ) ), fieldJrecv( NULL ), fieldE( NULL ),
         PMacc::math::CT::max<bmpl::_1, GetUpperMargin< GetCurrentSolver<bmpl::_2> > >
         >::type UpperMarginShapes;
 
+#if (ENABLE_FUSED_PUSH_CURRENT == 1)
+    /* the fused push deposits particles before they are shifted, they can
+     * be one cell outside of their supercell */
+    typedef PMacc::math::CT::make_Int<simDim, 1>::type OneCell;
+    typedef PMacc::math::CT::add<LowerMarginShapes, OneCell>::type LowerMarginDeposit;
+    typedef PMacc::math::CT::add<UpperMarginShapes, OneCell>::type UpperMarginDeposit;
+#else
+    typedef LowerMarginShapes LowerMarginDeposit;
+    typedef UpperMarginShapes UpperMarginDeposit;
+#endif
+
     /* margins are always positive, also for lower margins
      * additional current interpolations and current filters on FieldJ might
      * spread the dependencies on neighboring cells
      *   -> use max(shape,filter) */
     typedef PMacc::math::CT::max<
-        LowerMarginShapes,
+        LowerMarginDeposit,
         GetMargin<fieldSolver::CurrentInterpolation>::LowerMargin
         >::type LowerMargin;
 
     typedef PMacc::math::CT::max<
-        UpperMarginShapes,
+        UpperMarginDeposit,
         GetMargin<fieldSolver::CurrentInterpolation>::UpperMargin
         >::type UpperMargin;
 
@@ -267,13 +283,68 @@ FieldJ::getCommTag( )
 }
 
 template<uint32_t AREA, class ParticlesClass>
-void FieldJ::computeCurrent( ParticlesClass &parClass, uint32_t )
+void FieldJ::computeCurrent( ParticlesClass &parClass, uint32_t currentStep )
 {
+    /* sub-cycled species moved only in their push steps, the current of
+     * the whole move is deposited in this step */
+    if ( !traits::isPushStep<ParticlesClass>( currentStep ) )
+        return;
+
     /** tune paramter to use more threads than cells in a supercell
      *  valid domain: 1 <= workerMultiplier
+     *
+     *  With one thread per supercell there are no idle threads to hide
+     *  latencies, thus all frames are processed by one virtual block.
+     *  Otherwise the multiplier is selected by the work division tuner
+     *  out of the instantiated candidates 1, 2 and 4.
      */
-    const int workerMultiplier = 2;
+    if ( PMACC_SUPERCELL_PER_THREAD )
+    {
+        launchComputeCurrent<1, AREA>( parClass );
+        return;
+    }
+
+    std::stringstream tuningKey;
+    tuningKey << "KernelComputeCurrent_" << ParticlesClass::FrameType::getName( ) << "_" << AREA;
+    std::vector<uint32_t> candidates;
+    candidates.push_back( 1 );
+    candidates.push_back( 2 );
+    candidates.push_back( 4 );
+
+    WorkDivTuner& tuner = WorkDivTuner::getInstance( );
+    const uint32_t workerMultiplier = tuner.getBlockSize( tuningKey.str( ), candidates, 2 );
+    const bool measure = tuner.isMeasuring( tuningKey.str( ) );
+    TimeIntervall tCurrent;
+    if ( measure )
+    {
+        __getTransactionEvent( ).waitForFinished( );
+        tCurrent.toggleStart( );
+    }
+
+    switch ( workerMultiplier )
+    {
+    case 1:
+        launchComputeCurrent<1, AREA>( parClass );
+        break;
+    case 4:
+        launchComputeCurrent<4, AREA>( parClass );
+        break;
+    default:
+        launchComputeCurrent<2, AREA>( parClass );
+        break;
+    }
 
+    if ( measure )
+    {
+        __getTransactionEvent( ).waitForFinished( );
+        tCurrent.toggleEnd( );
+        tuner.addMeasurement( tuningKey.str( ), tCurrent.getInterval( ) );
+    }
+}
+
+template<int workerMultiplier, uint32_t AREA, class ParticlesClass>
+void FieldJ::launchComputeCurrent( ParticlesClass &parClass )
+{
     typedef typename ParticlesClass::FrameType FrameType;
     typedef typename PMacc::traits::Resolve<
         typename GetFlagType<FrameType, current<> >::type
@@ -287,29 +358,58 @@ void FieldJ::computeCurrent( ParticlesClass &parClass, uint32_t )
         typename GetMargin<ParticleCurrentSolver>::UpperMargin
         > BlockArea;
 
+    const float_X deltaTime = DELTA_T * float_X( traits::GetPushPeriod<ParticlesClass>::type::getValue( ) );
+
     StrideMapping<AREA, simDim, MappingDesc> mapper( cellDescription );
     typename ParticlesClass::ParticlesBoxType pBox = parClass.getDeviceParticlesBox( );
     FieldJ::DataBoxType jBox = this->fieldJ.getDeviceBuffer( ).getDataBox( );
-    FrameSolver solver( DELTA_T );
+    FrameSolver solver( deltaTime );
 
     DataSpace<simDim> blockSize( mapper.getSuperCellSize( ) );
     blockSize[simDim - 1] *= workerMultiplier;
 
     __startAtomicTransaction( __getTransactionEvent( ) );
-    do
+    if ( AREA == CORE + BORDER )
     {
-        KernelComputeCurrent<workerMultiplier, BlockArea, AREA> kernelComputeCurrent;
-        __cudaKernel(
-            kernelComputeCurrent,
-            alpaka::dim::DimInt<simDim>,
-            mapper.getGridDim( ),
-            blockSize)(
-                jBox,
-                pBox,
-                solver,
-                mapper );
+        /* visit only supercells with particles, each stride class of the
+         * list fulfills the same distance condition as the stride mapping */
+        typedef typename ParticlesClass::ActiveSuperCellListType ActiveList;
+        ActiveList& activeList = parClass.getActiveSuperCells( );
+        for ( uint32_t stride = 0; stride < ActiveList::NumStrides; ++stride )
+        {
+            typename ActiveList::Mapping strideMapper( activeList.getStrideMapping( stride ) );
+            if ( strideMapper.getSize( ) == 0 )
+                continue;
+
+            KernelComputeCurrent<workerMultiplier, BlockArea, AREA> kernelComputeCurrent;
+            __cudaKernelSuperCell(
+                kernelComputeCurrent,
+                alpaka::dim::DimInt<simDim>,
+                strideMapper.getGridDim( ),
+                blockSize)(
+                    jBox,
+                    pBox,
+                    solver,
+                    strideMapper );
+        }
+    }
+    else
+    {
+        do
+        {
+            KernelComputeCurrent<workerMultiplier, BlockArea, AREA> kernelComputeCurrent;
+            __cudaKernelSuperCell(
+                kernelComputeCurrent,
+                alpaka::dim::DimInt<simDim>,
+                mapper.getGridDim( ),
+                blockSize)(
+                    jBox,
+                    pBox,
+                    solver,
+                    mapper );
+        }
+        while ( mapper.next( ) );
     }
-    while ( mapper.next( ) );
     __setTransactionEvent( __endTransaction( ) );
 }
 
@@ -25,6 +25,7 @@
 #include "simulation_defines.hpp"
 
 #include <fields/MaxwellSolver/DirSplitting/DirSplitting.kernel>
+#include "memory/dataTypes/Mask.hpp"
 #include <math/vector/Int.hpp>
 #include <dataManagement/DataConnector.hpp>
 #include <fields/FieldB.hpp>
@@ -36,6 +37,8 @@
 #include <math/vector/TwistComponents.hpp>
 #include <math/vector/compile-time/TwistComponents.hpp>
 
+#include <algorithm>
+
 namespace picongpu
 {
 namespace dirSplitting
@@ -75,27 +78,93 @@ struct ConditionCheck<DirSplitting, T_Dummy>
 class DirSplitting : private ConditionCheck<fieldSolver::FieldSolver>
 {
 private:
+    /** Sweep along the twisted x direction
+     *
+     * \param lineOffset first line of the sweep in the twisted y, z plane
+     * \param lineCount number of lines in the twisted y, z plane, multiples
+     *                  of the twisted supercell size
+     */
     template<typename OrientationTwist,typename CursorE, typename CursorB, typename GridSize>
-    void propagate(CursorE cursorE, CursorB cursorB, GridSize gridSize) const
+    void propagate(CursorE cursorE, CursorB cursorB, GridSize gridSize,
+                   PMacc::math::Int<2> lineOffset, PMacc::math::Size_t<2> lineCount) const
     {
         using namespace cursor::tools;
         using namespace PMacc::math;
 
+        if (lineCount.x() == 0 || lineCount.y() == 0)
+            return;
+
         PMACC_AUTO(gridSizeTwisted, twistComponents<OrientationTwist>(gridSize));
 
         /* twist components of the supercell */
         typedef typename CT::TwistComponents<SuperCellSize, OrientationTwist>::type BlockDim;
 
         algorithm::kernel::ForeachBlock<BlockDim> foreach;
-        foreach(zone::SphericZone<3>(PMacc::math::Size_t<3>(BlockDim::x::value, gridSizeTwisted.y(), gridSizeTwisted.z())),
+        foreach(zone::SphericZone<3>(PMacc::math::Size_t<3>(BlockDim::x::value, lineCount.x(), lineCount.y()),
+                                     PMacc::math::Int<3>(0, lineOffset.x(), lineOffset.y())),
                 DirSplittingKernel<BlockDim>((int)gridSizeTwisted.x()),
                 cursor::make_NestedCursor(twistVectorFieldAxes<OrientationTwist>(cursorE)),
-                cursor::make_NestedCursor(twistVectorFieldAxes<OrientationTwist>(cursorB)),
-                );
+                cursor::make_NestedCursor(twistVectorFieldAxes<OrientationTwist>(cursorB)));
+    }
+
+    /** Sweep the lines whose twisted y is within a border
+     *
+     * \param border width of the border in cells
+     */
+    template<typename OrientationTwist,typename CursorE, typename CursorB, typename GridSize>
+    void propagateBorderY(CursorE cursorE, CursorB cursorB, GridSize gridSize, int border) const
+    {
+        PMACC_AUTO(gridSizeTwisted, PMacc::math::twistComponents<OrientationTwist>(gridSize));
+        const int sizeY = gridSizeTwisted.y();
+        const int sizeZ = gridSizeTwisted.z();
+
+        /* small grids have no inner lines, both borders may overlap */
+        const int lower = std::min(border, sizeY);
+        const int upper = std::max(std::min(border, sizeY - border), 0);
+
+        propagate<OrientationTwist>(cursorE, cursorB, gridSize,
+                                    PMacc::math::Int<2>(0, 0),
+                                    PMacc::math::Size_t<2>(lower, sizeZ));
+        propagate<OrientationTwist>(cursorE, cursorB, gridSize,
+                                    PMacc::math::Int<2>(sizeY - upper, 0),
+                                    PMacc::math::Size_t<2>(upper, sizeZ));
     }
+
+    /** Sweep the lines whose twisted y is not within a border */
+    template<typename OrientationTwist,typename CursorE, typename CursorB, typename GridSize>
+    void propagateInnerY(CursorE cursorE, CursorB cursorB, GridSize gridSize, int border) const
+    {
+        PMACC_AUTO(gridSizeTwisted, PMacc::math::twistComponents<OrientationTwist>(gridSize));
+        const int sizeY = gridSizeTwisted.y();
+        const int sizeZ = gridSizeTwisted.z();
+
+        propagate<OrientationTwist>(cursorE, cursorB, gridSize,
+                                    PMacc::math::Int<2>(border, 0),
+                                    PMacc::math::Size_t<2>(std::max(sizeY - 2 * border, 0), sizeZ));
+    }
+
+    /* exchanges of a field that hold data of the given axis */
+    static Mask getExchangesAlong(const ExchangeType positive, const ExchangeType negative)
+    {
+        Mask exchanges;
+        for (uint32_t i = 1; i < 27; ++i)
+        {
+            if (Mask(i).containsExchangeType(positive) || Mask(i).containsExchangeType(negative))
+                exchanges = exchanges + Mask(i);
+        }
+        return exchanges;
+    }
+
 public:
     DirSplitting(MappingDesc) {}
 
+    /** Propagate E and B by one step
+     *
+     * Each directional sweep only needs the guard cells at the faces
+     * normal to its direction. After a sweep the faces for the next
+     * direction are sent as soon as the lines next to these faces are
+     * done, the remaining lines are computed while the data is in flight.
+     */
     void update_beforeCurrent(uint32_t currentStep) const
     {
         typedef SuperCellSize GuardDim;
@@ -119,36 +188,104 @@ public:
 
         PMacc::math::Size_t<3> gridSize = fieldE_coreBorder.size();
 
+        /* cells of the BORDER, the data of an exchange is within */
+        const PMacc::math::Int<3> border(GuardDim::x::value * GUARD_SIZE,
+                                         GuardDim::y::value * GUARD_SIZE,
+                                         GuardDim::z::value * GUARD_SIZE);
 
+        /* x sweep: twisted y is y */
         typedef PMacc::math::CT::Int<0,1,2> Orientation_X;
-        propagate<Orientation_X>(
+        propagateBorderY<Orientation_X>(
                   fieldE_coreBorder.origin(),
                   fieldB_coreBorder.origin(),
-                  gridSize);
+                  gridSize, border.y());
+
+        const Mask facesY = Mask(TOP) + Mask(BOTTOM);
+        EventTask eRfieldE = fieldE.getGridBuffer().asyncCommunication(__getTransactionEvent(), facesY);
+        EventTask eRfieldB = fieldB.getGridBuffer().asyncCommunication(__getTransactionEvent(), facesY);
 
-        __setTransactionEvent(fieldE.asyncCommunication(__getTransactionEvent()));
-        __setTransactionEvent(fieldB.asyncCommunication(__getTransactionEvent()));
+        propagateInnerY<Orientation_X>(
+                  fieldE_coreBorder.origin(),
+                  fieldB_coreBorder.origin(),
+                  gridSize, border.y());
 
+        __setTransactionEvent(eRfieldE);
+        __setTransactionEvent(eRfieldB);
+
+        /* y sweep: twisted y is z */
         typedef PMacc::math::CT::Int<1,2,0> Orientation_Y;
-        propagate<Orientation_Y>(
+        propagateBorderY<Orientation_Y>(
                   fieldE_coreBorder.origin(),
                   fieldB_coreBorder.origin(),
-                  gridSize);
+                  gridSize, border.z());
 
-        __setTransactionEvent(fieldE.asyncCommunication(__getTransactionEvent()));
-        __setTransactionEvent(fieldB.asyncCommunication(__getTransactionEvent()));
+        const Mask facesZ = Mask(FRONT) + Mask(BACK);
+        eRfieldE = fieldE.getGridBuffer().asyncCommunication(__getTransactionEvent(), facesZ);
+        eRfieldB = fieldB.getGridBuffer().asyncCommunication(__getTransactionEvent(), facesZ);
 
+        propagateInnerY<Orientation_Y>(
+                  fieldE_coreBorder.origin(),
+                  fieldB_coreBorder.origin(),
+                  gridSize, border.z());
+
+        __setTransactionEvent(eRfieldE);
+        __setTransactionEvent(eRfieldB);
+
+        /* z sweep: twisted y is x, twisted z is y
+         *
+         * The lines within the x or y BORDER hold all exchanges without a
+         * z component, the laser is within the y BORDER. Exchanges with a
+         * z component contain cells of all lines.
+         */
         typedef PMacc::math::CT::Int<2,0,1> Orientation_Z;
+        const int innerX = std::max((int)gridSize.x() - 2 * border.x(), 0);
+        const int innerY = std::max((int)gridSize.y() - 2 * border.y(), 0);
+        const int lowerY = std::min(border.y(), (int)gridSize.y());
+        const int upperY = std::max(std::min(border.y(), (int)gridSize.y() - border.y()), 0);
+
+        propagateBorderY<Orientation_Z>(
+                  fieldE_coreBorder.origin(),
+                  fieldB_coreBorder.origin(),
+                  gridSize, border.x());
+        propagate<Orientation_Z>(
+                  fieldE_coreBorder.origin(),
+                  fieldB_coreBorder.origin(),
+                  gridSize,
+                  PMacc::math::Int<2>(border.x(), 0),
+                  PMacc::math::Size_t<2>(innerX, lowerY));
         propagate<Orientation_Z>(
                   fieldE_coreBorder.origin(),
                   fieldB_coreBorder.origin(),
-                  gridSize);
+                  gridSize,
+                  PMacc::math::Int<2>(border.x(), (int)gridSize.y() - upperY),
+                  PMacc::math::Size_t<2>(innerX, upperY));
 
         if (laserProfile::INIT_TIME > float_X(0.0))
             dc.getData<FieldE > (FieldE::getName(), true).laserManipulation(currentStep);
 
-        __setTransactionEvent(fieldE.asyncCommunication(__getTransactionEvent()));
-        __setTransactionEvent(fieldB.asyncCommunication(__getTransactionEvent()));
+        const Mask alongZ = getExchangesAlong(BACK, FRONT);
+        Mask notAlongZ;
+        for (uint32_t i = 1; i < 27; ++i)
+        {
+            if (!alongZ.isSet(i))
+                notAlongZ = notAlongZ + Mask(i);
+        }
+
+        eRfieldE = fieldE.getGridBuffer().asyncCommunication(__getTransactionEvent(), notAlongZ);
+        eRfieldB = fieldB.getGridBuffer().asyncCommunication(__getTransactionEvent(), notAlongZ);
+
+        propagate<Orientation_Z>(
+                  fieldE_coreBorder.origin(),
+                  fieldB_coreBorder.origin(),
+                  gridSize,
+                  PMacc::math::Int<2>(border.x(), border.y()),
+                  PMacc::math::Size_t<2>(innerX, innerY));
+
+        eRfieldE += fieldE.getGridBuffer().asyncCommunication(__getTransactionEvent(), alongZ);
+        eRfieldB += fieldB.getGridBuffer().asyncCommunication(__getTransactionEvent(), alongZ);
+
+        __setTransactionEvent(eRfieldE);
+        __setTransactionEvent(eRfieldB);
     }
 
     void update_afterCurrent(uint32_t) const
@@ -166,6 +303,10 @@ public:
         dc.releaseData(FieldE::getName());
         dc.releaseData(FieldB::getName());
     }
+
+    void synchronize(uint32_t) const
+    {
+    }
 };
 
 } // dirSplitting
@@ -76,6 +76,11 @@ namespace picongpu
             {
 
             }
+
+            void synchronize(uint32_t)
+            {
+
+            }
         };
 
     } // namespace noSolver
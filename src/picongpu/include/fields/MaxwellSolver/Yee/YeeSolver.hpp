@@ -37,9 +37,19 @@
 #include "mappings/threads/ThreadCollective.hpp"
 #include "memory/boxes/CachedBox.hpp"
 #include "dimensions/DataSpace.hpp"
+#include "memory/buffers/GridBuffer.hpp"
+#include "mappings/kernel/AreaMapping.hpp"
+#include "mappings/threads/ElementMapping.hpp"
+#include "eventSystem/profiling/ProfileRegistry.hpp"
+#include "mappings/simulation/GridController.hpp"
+#include "algorithms/ForEach.hpp"
+#include "compileTime/conversion/TypeToPointerPair.hpp"
 #include <fields/FieldE.hpp>
 #include <fields/FieldB.hpp>
 
+#include <algorithm>
+#include <string>
+
 #include "fields/FieldManipulator.hpp"
 #include "fields/MaxwellSolver/Yee/YeeSolver.kernel"
 
@@ -49,18 +59,58 @@ namespace yeeSolver
 {
 using namespace PMacc;
 
+/** Mark the supercells with particles of a species
+ *
+ * \tparam T_SpeciesName identifier of the species
+ */
+template<typename T_SpeciesName>
+struct MarkOccupiedSuperCells
+{
+    typedef T_SpeciesName SpeciesName;
+    typedef typename SpeciesName::type SpeciesType;
+
+    template<typename T_OccupiedBox>
+    HINLINE void operator()(const T_OccupiedBox occupiedBox) const
+    {
+        DataConnector &dc = Environment<>::get().DataConnector();
+        SpeciesType& species = dc.getData<SpeciesType > (SpeciesType::FrameType::getName(), true);
+
+        typename SpeciesType::ActiveSuperCellListType::Mapping activeMapper(
+            species.getActiveSuperCells().getMapping());
+
+        KernelMarkOccupiedSuperCells kernelMarkOccupiedSuperCells;
+        __picKernelList(
+            kernelMarkOccupiedSuperCells,
+            alpaka::dim::DimInt<simDim>,
+            activeMapper,
+            CORE + BORDER,
+            DataSpace<simDim>::create(1))(
+                occupiedBox);
+    }
+};
 
-template<class CurlE, class CurlB>
+template<class CurlE, class CurlB, class T_FieldUpdate>
 class YeeSolver
 {
 private:
     typedef MappingDesc::SuperCellSize SuperCellSize;
+    typedef GridBuffer<uint32_t, simDim> OccupiedBuffer;
 
 
     FieldE* fieldE;
     FieldB* fieldB;
     MappingDesc cellDescription;
 
+    /* ENABLE_YEE_TEMPORAL_BLOCKING: supercells with particles,
+     * see isVacuumSuperCell() */
+    OccupiedBuffer* occupied;
+    /* range of supercells which can be ahead: CORE without the supercells
+     * next to BORDER and without the absorber */
+    DataSpace<simDim> vacuumBegin;
+    DataSpace<simDim> vacuumEnd;
+    /* B of the vacuum supercells is half a step ahead */
+    bool isBAhead;
+
     template<uint32_t AREA>
     void updateE()
     {
@@ -69,6 +119,38 @@ private:
             (SPEED_OF_LIGHT*SPEED_OF_LIGHT*DELTA_T*DELTA_T*INV_CELL2_SUM)<=1.0,
             "Courant Friedrichs Levy condition failure. Check your gridConfig.param file.");
 
+        updateE<AREA>(T_FieldUpdate());
+    }
+
+    template<uint32_t AREA>
+    void updateBHalf()
+    {
+        updateBHalf<AREA>(T_FieldUpdate());
+    }
+
+    /** Add the memory traffic of a field update to the profile
+     *
+     * Counts the minimal traffic: read the curl of the other field, read
+     * and write the updated field.
+     *
+     * \param kernelName name of the kernel variable in the launch
+     */
+    template<uint32_t AREA>
+    void addUpdateBytes(const std::string& kernelName) const
+    {
+        ProfileRegistry& registry = ProfileRegistry::getInstance();
+        if (!registry.isEnabled())
+            return;
+
+        AreaMapping<AREA, MappingDesc> mapper(cellDescription);
+        const uint64_t cells = uint64_t(mapper.getGridDim().productOfComponents()) *
+            uint64_t(SuperCellSize::toRT().productOfComponents());
+        registry.addBytes(kernelName, cells * 3u * sizeof(float3_X));
+    }
+
+    template<uint32_t AREA>
+    void updateE(yeeUpdate::CellPerThread)
+    {
         typedef SuperCellDescription<
                 SuperCellSize,
                 typename CurlB::LowerMargin,
@@ -84,10 +166,26 @@ private:
             SuperCellSize::toRT())(
                 this->fieldE->getDeviceDataBox(),
                 this->fieldB->getDeviceDataBox());
+        addUpdateBytes<AREA>("kernelUpdateE");
     }
 
     template<uint32_t AREA>
-    void updateBHalf()
+    void updateE(yeeUpdate::LinePerThread)
+    {
+        KernelUpdateELines<CurlB> kernelUpdateELines;
+        __picKernelAreaSuperCell(
+            kernelUpdateELines,
+            alpaka::dim::DimInt<simDim>,
+            cellDescription,
+            AREA,
+            SuperCellSize::toRT())(
+                this->fieldE->getDeviceDataBox(),
+                this->fieldB->getDeviceDataBox());
+        addUpdateBytes<AREA>("kernelUpdateELines");
+    }
+
+    template<uint32_t AREA>
+    void updateBHalf(yeeUpdate::CellPerThread)
     {
         typedef SuperCellDescription<
                 SuperCellSize,
@@ -104,21 +202,127 @@ private:
             SuperCellSize::toRT())(
                 this->fieldB->getDeviceDataBox(),
                 this->fieldE->getDeviceDataBox());
+        addUpdateBytes<AREA>("kernelUpdateBHalf");
+    }
+
+    template<uint32_t AREA>
+    void updateBHalf(yeeUpdate::LinePerThread)
+    {
+        KernelUpdateBHalfLines<CurlE> kernelUpdateBHalfLines;
+        __picKernelAreaSuperCell(
+            kernelUpdateBHalfLines,
+            alpaka::dim::DimInt<simDim>,
+            cellDescription,
+            AREA,
+            SuperCellSize::toRT())(
+                this->fieldB->getDeviceDataBox(),
+                this->fieldE->getDeviceDataBox());
+        addUpdateBytes<AREA>("kernelUpdateBHalfLines");
+    }
+
+    /** Advance B of CORE by half steps
+     *
+     * \param vacuumHalfSteps half steps of the vacuum supercells
+     * \param halfSteps half steps of all other supercells
+     */
+    void updateBBlocked(float_X vacuumHalfSteps, float_X halfSteps)
+    {
+        typedef SuperCellDescription<
+                SuperCellSize,
+                typename CurlE::LowerMargin,
+                typename CurlE::UpperMargin
+                > BlockArea;
+
+        KernelUpdateBBlocked<BlockArea, CurlE> kernelUpdateBBlocked;
+        __picKernelArea(
+            kernelUpdateBBlocked,
+            alpaka::dim::DimInt<simDim>,
+            cellDescription,
+            CORE,
+            SuperCellSize::toRT())(
+                this->fieldB->getDeviceDataBox(),
+                this->fieldE->getDeviceDataBox(),
+                occupied->getDeviceBuffer().getDataBox(),
+                vacuumBegin,
+                vacuumEnd,
+                vacuumHalfSteps,
+                halfSteps);
+    }
+
+    /* flag all supercells with particles of any species */
+    void markOccupiedSuperCells()
+    {
+        occupied->getDeviceBuffer().setValue(0);
+
+        ForEach<VectorAllSpecies, MarkOccupiedSuperCells<bmpl::_1>, MakeIdentifier<bmpl::_1> > markOccupied;
+        markOccupied(occupied->getDeviceBuffer().getDataBox());
+    }
+
+    /* exclude the supercells next to BORDER (neighbors of particles from
+     * other GPUs) and the absorber (absorbs B at full steps) */
+    void initVacuumRange()
+    {
+        const int guard = cellDescription.getGuardingSuperCells();
+        const DataSpace<simDim> superCells(cellDescription.getGridSuperCells());
+        const DataSpace<simDim> superCellSize(SuperCellSize::toRT());
+        const Mask& commMask = Environment<simDim>::get().GridController().getCommunicationMask();
+
+        /* exchanges of the negative and positive side of each direction */
+        const uint32_t exchanges[3][2] = {
+            {LEFT, RIGHT},
+            {TOP, BOTTOM},
+            {FRONT, BACK}
+        };
+
+        vacuumBegin = DataSpace<simDim>::create(2 * guard + 1);
+        vacuumEnd = superCells - vacuumBegin;
+        for (uint32_t d = 0; d < simDim; ++d)
+        {
+            const int absorberNeg = guard + (ABSORBER_CELLS[d][0] + superCellSize[d] - 1) / superCellSize[d];
+            const int absorberPos = guard + (ABSORBER_CELLS[d][1] + superCellSize[d] - 1) / superCellSize[d];
+
+            if (!commMask.isSet(exchanges[d][0]))
+                vacuumBegin[d] = std::max(vacuumBegin[d], absorberNeg);
+            if (!commMask.isSet(exchanges[d][1]))
+                vacuumEnd[d] = std::min(vacuumEnd[d], superCells[d] - absorberPos);
+        }
     }
 
 public:
 
-    YeeSolver(MappingDesc cellDescription) : cellDescription(cellDescription)
+    YeeSolver(MappingDesc cellDescription) :
+    cellDescription(cellDescription), occupied(NULL), isBAhead(false)
     {
         DataConnector &dc = Environment<>::get().DataConnector();
 
         this->fieldE = &dc.getData<FieldE > (FieldE::getName(), true);
         this->fieldB = &dc.getData<FieldB > (FieldB::getName(), true);
+
+#if (ENABLE_YEE_TEMPORAL_BLOCKING == 1)
+        occupied = new OccupiedBuffer(cellDescription.getGridSuperCells());
+        occupied->getDeviceBuffer().setValue(1);
+        initVacuumRange();
+#endif
+    }
+
+    ~YeeSolver()
+    {
+        __delete(occupied);
     }
 
     void update_beforeCurrent(uint32_t)
     {
+#if (ENABLE_YEE_TEMPORAL_BLOCKING == 1)
+        /* the vacuum supercells did this half step at the end of the last step */
+        if (isBAhead)
+            updateBBlocked(float_X(0.0), float_X(1.0));
+        else
+            updateBHalf < CORE >();
+        updateBHalf < BORDER >();
+        isBAhead = false;
+#else
         updateBHalf < CORE+BORDER >();
+#endif
         EventTask eRfieldB = fieldB->asyncCommunication(__getTransactionEvent());
 
         updateE<CORE>();
@@ -134,7 +338,15 @@ public:
 
         EventTask eRfieldE = fieldE->asyncCommunication(__getTransactionEvent());
 
+#if (ENABLE_YEE_TEMPORAL_BLOCKING == 1)
+        /* E does not change until the first half step of the next step,
+         * supercells whose B is not needed by the pusher do both at once */
+        markOccupiedSuperCells();
+        updateBBlocked(float_X(2.0), float_X(1.0));
+        isBAhead = true;
+#else
         updateBHalf < CORE> ();
+#endif
         __setTransactionEvent(eRfieldE);
         updateBHalf < BORDER > ();
 
@@ -143,6 +355,21 @@ public:
         EventTask eRfieldB = fieldB->asyncCommunication(__getTransactionEvent());
         __setTransactionEvent(eRfieldB);
     }
+
+    /** Bring all fields to the same time level
+     *
+     * Must be called before E and B are used outside of the solver,
+     * e.g. by plugins, checkpoints or a slide of the moving window.
+     */
+    void synchronize(uint32_t)
+    {
+#if (ENABLE_YEE_TEMPORAL_BLOCKING == 1)
+        /* E is unchanged since the full step, revert its second half */
+        if (isBAhead)
+            updateBBlocked(float_X(-1.0), float_X(0.0));
+        isBAhead = false;
+#endif
+    }
 };
 
 } // yeeSolver
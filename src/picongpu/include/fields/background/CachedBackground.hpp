@@ -0,0 +1,243 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+#include "math/Vector.hpp"
+#include "dimensions/DataSpace.hpp"
+#include "memory/buffers/DeviceBufferIntern.hpp"
+
+namespace picongpu
+{
+namespace fieldBackground
+{
+    using namespace PMacc;
+
+    /** Samples of a background field in time
+     *
+     * Every `stride` steps the wrapped functor is evaluated for all local
+     * cells (including the GUARD). The table holds the samples
+     * base ... base + NumSamples - 1 around the current step, see
+     * getBaseSample().
+     *
+     * This class is a singleton per background field functor.
+     *
+     * \tparam T_Functor background field functor, \see CachedBackground
+     */
+    template<typename T_Functor>
+    class CachedBackgroundTable
+    {
+    public:
+        enum
+        {
+            NumSamples = 4
+        };
+
+        /* samples are only read on the device, no host buffer */
+        typedef DeviceBufferIntern<float3_X, simDim> SampleBuffer;
+        typedef typename SampleBuffer::DataBoxType DataBoxType;
+
+        /** allocate the device memory of the samples
+         *
+         * Must be called before the particle heap takes the free device
+         * memory, does nothing if the field is evaluated directly.
+         */
+        HINLINE void allocate( );
+
+        /** Make sure the table holds the samples needed for currentStep
+         *
+         * Without allocate() the field is evaluated directly.
+         * Recomputes at most one sample per `stride` steps, all samples
+         * after a slide of the moving window or a jump in time.
+         *
+         * \param unitField unit to construct the functor with
+         * \param currentStep time step the table is used for
+         */
+        HINLINE void update( const float3_64 unitField, const uint32_t currentStep );
+
+        /** free the device memory of the table */
+        HINLINE void release( );
+
+        /** number of steps between two samples, 0 if the field is evaluated directly */
+        HINLINE uint32_t getStride( ) const
+        {
+            return stride;
+        }
+
+        /** true if update() filled the table */
+        HINLINE bool isReady( ) const
+        {
+            return isFilled;
+        }
+
+        HINLINE DataBoxType getDataBox( const uint32_t slot ) const;
+
+        /** total cell index of the first local cell (including the GUARD) */
+        HINLINE DataSpace<simDim> getTotalCellOffset( ) const
+        {
+            return totalCellOffset;
+        }
+
+        /** first sample used to interpolate a step
+         *
+         * Steps between two samples use the two samples before and after
+         * them, the first steps the samples 0 ... 3.
+         */
+        HDINLINE static uint32_t getBaseSample( const uint32_t currentStep, const uint32_t stride )
+        {
+            const uint32_t sample = currentStep / stride;
+            return sample > 0 ? sample - 1 : 0;
+        }
+
+        static CachedBackgroundTable& getInstance( )
+        {
+            static CachedBackgroundTable instance;
+            return instance;
+        }
+
+    private:
+
+        HINLINE CachedBackgroundTable( );
+
+        CachedBackgroundTable( const CachedBackgroundTable& );
+
+        /* evaluate the functor for a sample and store it in its slot */
+        HINLINE void fillSample( const T_Functor& functor, const uint32_t sample );
+
+        SampleBuffer* samples[NumSamples];
+        uint32_t stride;
+        /* first sample in the table */
+        uint32_t firstSample;
+        bool isFilled;
+        uint32_t numSlides;
+        DataSpace<simDim> totalCellOffset;
+    };
+
+    /** Tabulate an expensive background field in time
+     *
+     * Drop-in replacement of FieldBackgroundE/B:
+     *
+     *   typedef fieldBackground::CachedBackground<MyFieldE> FieldBackgroundE;
+     *
+     * The field of each cell is interpolated with a cubic polynomial
+     * between samples that are `stride` steps apart. The stride is chosen
+     * at startup from two constants of T_Functor:
+     *   - CACHE_PERIOD_SI: shortest period of the field in time [s],
+     *     e.g. the laser period
+     *   - CACHE_TOLERANCE: maximum interpolation error relative to the
+     *     amplitude, 0 disables the cache
+     * If the stride would be below 2 steps the field is evaluated directly.
+     *
+     * \tparam T_Functor background field functor with
+     *         InfluenceParticlePusher and a host constructor from the unit
+     */
+    template<typename T_Functor>
+    class CachedBackground
+    {
+    public:
+        /* Add this additional field for pushing particles */
+        static const bool InfluenceParticlePusher = T_Functor::InfluenceParticlePusher;
+
+        typedef CachedBackgroundTable<T_Functor> Table;
+
+        HINLINE CachedBackground( const float3_64 unitField );
+
+        /** Interpolate the background field from the table
+         *
+         * \param cellIdx The total cell id counted from the start at t = 0
+         * \param currentStep The current time step */
+        HDINLINE float3_X
+        operator()( const DataSpace<simDim>& cellIdx,
+                    const uint32_t currentStep ) const
+        {
+            if( stride == 0 )
+                return functor( cellIdx, currentStep );
+
+            const DataSpace<simDim> localCell( cellIdx - totalCellOffset );
+            const uint32_t base = Table::getBaseSample( currentStep, stride );
+            /* position between the samples in units of samples */
+            const float_X x = float_X( currentStep - base * stride ) / float_X( stride );
+
+            /* Lagrange weights of the samples base ... base + 3 */
+            const float_X w0 = -( x - float_X(1.0) ) * ( x - float_X(2.0) ) * ( x - float_X(3.0) ) / float_X(6.0);
+            const float_X w1 = x * ( x - float_X(2.0) ) * ( x - float_X(3.0) ) / float_X(2.0);
+            const float_X w2 = -x * ( x - float_X(1.0) ) * ( x - float_X(3.0) ) / float_X(2.0);
+            const float_X w3 = x * ( x - float_X(1.0) ) * ( x - float_X(2.0) ) / float_X(6.0);
+
+            return samples[ base % Table::NumSamples ]( localCell ) * w0 +
+                samples[ ( base + 1 ) % Table::NumSamples ]( localCell ) * w1 +
+                samples[ ( base + 2 ) % Table::NumSamples ]( localCell ) * w2 +
+                samples[ ( base + 3 ) % Table::NumSamples ]( localCell ) * w3;
+        }
+
+    private:
+        PMACC_ALIGN(functor, T_Functor);
+        typename Table::DataBoxType samples[Table::NumSamples];
+        PMACC_ALIGN(totalCellOffset, DataSpace<simDim>);
+        PMACC_ALIGN(stride, uint32_t);
+    };
+
+    /** Host side control of the table of a background field
+     *
+     * Called by the simulation before a background field is used in a
+     * step, fields without table need nothing. Only fields which are
+     * added for the particle pusher are read, others get no table.
+     */
+    template<typename T_Functor>
+    struct BackgroundCache
+    {
+        HINLINE static void allocate( )
+        {
+        }
+
+        HINLINE static void update( const float3_64, const uint32_t )
+        {
+        }
+
+        HINLINE static void release( )
+        {
+        }
+    };
+
+    template<typename T_Functor>
+    struct BackgroundCache<CachedBackground<T_Functor> >
+    {
+        HINLINE static void allocate( )
+        {
+            if( CachedBackground<T_Functor>::InfluenceParticlePusher )
+                CachedBackgroundTable<T_Functor>::getInstance( ).allocate( );
+        }
+
+        HINLINE static void update( const float3_64 unitField, const uint32_t currentStep )
+        {
+            if( CachedBackground<T_Functor>::InfluenceParticlePusher )
+                CachedBackgroundTable<T_Functor>::getInstance( ).update( unitField, currentStep );
+        }
+
+        HINLINE static void release( )
+        {
+            CachedBackgroundTable<T_Functor>::getInstance( ).release( );
+        }
+    };
+
+} // namespace fieldBackground
+} // namespace picongpu
@@ -0,0 +1,180 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "simulation_defines.hpp"
+
+#include "fields/background/CachedBackground.hpp"
+#include "fields/background/cellwiseOperation.hpp"
+
+#include "dimensions/DataSpace.hpp"
+#include "mappings/simulation/SubGrid.hpp"
+#include "mappings/kernel/MappingDescription.hpp"
+#include "simulationControl/MovingWindow.hpp"
+#include "nvidia/functors/Assign.hpp"
+
+#include <cmath>
+
+namespace picongpu
+{
+namespace fieldBackground
+{
+    using namespace PMacc;
+
+    template<typename T_Functor>
+    HINLINE
+    CachedBackgroundTable<T_Functor>::CachedBackgroundTable( ) :
+        stride(0), firstSample(0), isFilled(false), numSlides(0)
+    {
+        for( uint32_t i = 0; i < NumSamples; ++i )
+            samples[i] = NULL;
+
+        /* The error of a cubic interpolation of cos(omega * t) between the
+         * two inner of four samples is below 9/384 * (omega * h)^4 */
+        const float_64 tolerance = T_Functor::CACHE_TOLERANCE;
+        if( tolerance > 0.0 )
+        {
+            const float_64 omega = 2.0 * PI / T_Functor::CACHE_PERIOD_SI;
+            const float_64 maxSampleTime = std::pow( 384.0 / 9.0 * tolerance, 0.25 ) / omega;
+            stride = static_cast<uint32_t>( maxSampleTime / SI::DELTA_T_SI );
+        }
+        /* with less than two steps per sample the table saves nothing */
+        if( stride < 2 )
+            stride = 0;
+
+        if( stride == 0 )
+            log<picLog::PHYSICS > ( "background field cache disabled, direct evaluation" );
+        else
+            log<picLog::PHYSICS > ( "background field cache: one sample every %1% steps" ) % stride;
+    }
+
+    template<typename T_Functor>
+    HINLINE void
+    CachedBackgroundTable<T_Functor>::allocate( )
+    {
+        if( stride == 0 || samples[0] != NULL )
+            return;
+
+        const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
+        const DataSpace<simDim> localCells( subGrid.getLocalDomain().size +
+            MappingDesc::SuperCellSize::toRT() * int(2 * GUARD_SIZE) );
+
+        for( uint32_t i = 0; i < NumSamples; ++i )
+            samples[i] = new SampleBuffer( localCells );
+    }
+
+    template<typename T_Functor>
+    HINLINE void
+    CachedBackgroundTable<T_Functor>::update( const float3_64 unitField, const uint32_t currentStep )
+    {
+        if( stride == 0 || samples[0] == NULL )
+            return;
+
+        const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
+        const DataSpace<simDim> guardCells( MappingDesc::SuperCellSize::toRT() * int(GUARD_SIZE) );
+
+        const T_Functor functor( unitField );
+        const uint32_t slides = MovingWindow::getInstance().getSlideCounter( currentStep );
+        const uint32_t base = getBaseSample( currentStep, stride );
+
+        /* the table is stored per local cell, a slide moves all cells */
+        if( !isFilled || slides != numSlides ||
+            base < firstSample || base >= firstSample + NumSamples )
+        {
+            numSlides = slides;
+            totalCellOffset = subGrid.getLocalDomain().offset;
+            /** Assumption: all GPUs have the same number of cells in
+             *              y direction for sliding window */
+            totalCellOffset.y() += numSlides * subGrid.getLocalDomain().size.y();
+            totalCellOffset -= guardCells;
+
+            firstSample = base;
+            for( uint32_t i = 0; i < NumSamples; ++i )
+                fillSample( functor, firstSample + i );
+            isFilled = true;
+        }
+
+        /* replace the oldest sample by the next one */
+        while( firstSample < base )
+        {
+            fillSample( functor, firstSample + NumSamples );
+            ++firstSample;
+        }
+    }
+
+    template<typename T_Functor>
+    HINLINE void
+    CachedBackgroundTable<T_Functor>::fillSample( const T_Functor& functor, const uint32_t sample )
+    {
+        const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
+        const DataSpace<simDim> localCells( subGrid.getLocalDomain().size +
+            MappingDesc::SuperCellSize::toRT() * int(2 * GUARD_SIZE) );
+        const MappingDesc cellDescription( localCells, GUARD_SIZE, GUARD_SIZE );
+
+        cellwiseOperation::KernelCellwiseOperation kernelCellwiseOperation;
+        __picKernelArea(
+            kernelCellwiseOperation,
+            alpaka::dim::DimInt<simDim>,
+            cellDescription,
+            CORE + BORDER + GUARD,
+            MappingDesc::SuperCellSize::toRT())(
+                samples[sample % NumSamples]->getDataBox(),
+                nvidia::functors::Assign(),
+                functor,
+                totalCellOffset,
+                sample * stride);
+    }
+
+    template<typename T_Functor>
+    HINLINE void
+    CachedBackgroundTable<T_Functor>::release( )
+    {
+        for( uint32_t i = 0; i < NumSamples; ++i )
+            __delete(samples[i]);
+        isFilled = false;
+    }
+
+    template<typename T_Functor>
+    HINLINE typename CachedBackgroundTable<T_Functor>::DataBoxType
+    CachedBackgroundTable<T_Functor>::getDataBox( const uint32_t slot ) const
+    {
+        return samples[slot]->getDataBox();
+    }
+
+    template<typename T_Functor>
+    HINLINE
+    CachedBackground<T_Functor>::CachedBackground( const float3_64 unitField ) :
+        functor( unitField )
+    {
+        const Table& table = Table::getInstance();
+        /* fall back to the direct evaluation until the table is filled */
+        stride = table.isReady() ? table.getStride() : 0;
+        totalCellOffset = table.getTotalCellOffset();
+        if( stride != 0 )
+        {
+            for( uint32_t i = 0; i < Table::NumSamples; ++i )
+                samples[i] = table.getDataBox( i );
+        }
+    }
+
+} // namespace fieldBackground
+} // namespace picongpu
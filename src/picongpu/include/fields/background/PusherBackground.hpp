@@ -0,0 +1,154 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "simulation_defines.hpp"
+
+#include "dimensions/DataSpace.hpp"
+#include "mappings/simulation/SubGrid.hpp"
+#include "mappings/kernel/MappingDescription.hpp"
+#include "simulationControl/MovingWindow.hpp"
+#include "nvidia/functors/Assign.hpp"
+
+
+namespace picongpu
+{
+namespace fieldBackground
+{
+    using namespace PMacc;
+
+    /** Assign the sum of a field value and its background to a cache cell */
+    struct AssignWithBackground
+    {
+        template<typename Dst, typename Src, typename Background>
+        HDINLINE void operator()(Dst & dst, const Src & src, const Background & background) const
+        {
+            dst = src + background;
+        }
+    };
+
+    /** Background field of the cells of a block
+     *
+     * Behaves like a data box: cellIdx is relative to the block origin.
+     *
+     * \tparam T_ValFunctor background field functor, e.g. FieldBackgroundE
+     */
+    template<typename T_ValFunctor>
+    struct BackgroundBlock
+    {
+        HDINLINE BackgroundBlock( const T_ValFunctor& valFunctor,
+                                  const DataSpace<simDim>& totalCellOffset,
+                                  const uint32_t currentStep ) :
+            valFunctor(valFunctor), totalCellOffset(totalCellOffset), currentStep(currentStep)
+        {
+        }
+
+        HDINLINE float3_X operator()( const DataSpace<simDim>& cellIdx ) const
+        {
+            return valFunctor( totalCellOffset + cellIdx, currentStep );
+        }
+
+        PMACC_ALIGN(valFunctor, T_ValFunctor);
+        PMACC_ALIGN(totalCellOffset, DataSpace<simDim>);
+        PMACC_ALIGN(currentStep, uint32_t);
+    };
+
+    /** Load a field into the shared memory cache of a particle kernel
+     *
+     * With ENABLE_PUSHER_BACKGROUND_FIELDS the background field of a
+     * functor with InfluenceParticlePusher is added while the field is
+     * cached, otherwise the field is copied unchanged.
+     *
+     * \tparam T_ValFunctor background field functor, e.g. FieldBackgroundE
+     */
+    template<typename T_ValFunctor,
+             bool T_enabled = (ENABLE_PUSHER_BACKGROUND_FIELDS == 1) && T_ValFunctor::InfluenceParticlePusher>
+    class PusherBackground
+    {
+    public:
+
+        /** constructor on the host
+         *
+         * \param valFunctor background field functor
+         * \param currentStep time step the background is evaluated for
+         */
+        HINLINE PusherBackground( const T_ValFunctor& valFunctor, const uint32_t currentStep ) :
+            valFunctor(valFunctor), currentStep(currentStep)
+        {
+            const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
+            /** offset due to being the n-th GPU */
+            totalCellOffset = subGrid.getLocalDomain().offset;
+            const uint32_t numSlides = MovingWindow::getInstance().getSlideCounter( currentStep );
+
+            /** Assumption: all GPUs have the same number of cells in
+             *              y direction for sliding window */
+            totalCellOffset.y() += numSlides * subGrid.getLocalDomain().size.y();
+            /* block origins of kernels count the GUARD */
+            totalCellOffset -= MappingDesc::SuperCellSize::toRT() * int(GUARD_SIZE);
+        }
+
+        /** Cache a block of a field
+         *
+         * \param collective ThreadCollective of the calling thread
+         * \param cache shared memory box of the block
+         * \param fieldBlock field data box shifted to the block origin
+         * \param blockCell block origin in cells (including the GUARD)
+         */
+        template<typename T_Collective, typename T_Cache, typename T_FieldBlock>
+        DINLINE void load( T_Collective& collective,
+                           T_Cache& cache,
+                           const T_FieldBlock& fieldBlock,
+                           const DataSpace<simDim>& blockCell ) const
+        {
+            const BackgroundBlock<T_ValFunctor> backgroundBlock( valFunctor,
+                                                                 totalCellOffset + blockCell,
+                                                                 currentStep );
+            collective( AssignWithBackground(), cache, fieldBlock, backgroundBlock );
+        }
+
+    private:
+        PMACC_ALIGN(valFunctor, T_ValFunctor);
+        PMACC_ALIGN(totalCellOffset, DataSpace<simDim>);
+        PMACC_ALIGN(currentStep, uint32_t);
+    };
+
+    template<typename T_ValFunctor>
+    class PusherBackground<T_ValFunctor, false>
+    {
+    public:
+
+        HINLINE PusherBackground( const T_ValFunctor&, const uint32_t )
+        {
+        }
+
+        template<typename T_Collective, typename T_Cache, typename T_FieldBlock>
+        DINLINE void load( T_Collective& collective,
+                           T_Cache& cache,
+                           const T_FieldBlock& fieldBlock,
+                           const DataSpace<simDim>& ) const
+        {
+            collective( nvidia::functors::Assign(), cache, fieldBlock );
+        }
+    };
+
+} // namespace fieldBackground
+} // namespace picongpu
@@ -60,6 +60,7 @@ struct EsirkepovNative
     static const int end = currentUpperMargin + 1;
 
     float_X charge;
+    float_X deltaTime;
 
     /* At the moment Esirkepov only support YeeCell were W is defined at origin (0,0,0)
      *
@@ -79,6 +80,7 @@ struct EsirkepovNative
         const ChargeType charge, const float_X deltaTime)
     {
         this->charge = charge;
+        this->deltaTime = deltaTime;
         const float3_X deltaPos = float3_X(velocity.x() * deltaTime / cellSize.x(),
                                            velocity.y() * deltaTime / cellSize.y(),
                                            velocity.z() * deltaTime / cellSize.z());
@@ -133,8 +135,8 @@ struct EsirkepovNative
                 {
                     float_X W = DS(line, k, 3) * tmp;
                     /* We multiply with `cellEdgeLength` due to the fact that the attribute for the
-                     * in-cell particle `position` (and it's change in DELTA_T) is normalize to [0,1) */
-                    accumulated_J += -this->charge * (float_X(1.0) / float_X(CELL_VOLUME * DELTA_T)) * W * cellEdgeLength;
+                     * in-cell particle `position` (and it's change in deltaTime) is normalize to [0,1) */
+                    accumulated_J += -this->charge * (float_X(1.0) / float_X(CELL_VOLUME * this->deltaTime)) * W * cellEdgeLength;
                     alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &((*cursorJ(i, j, k)).z()), accumulated_J);
                 }
             }
@@ -50,16 +50,12 @@ namespace PMacc
             state = Init;
             EventTask serialEvent = __getTransactionEvent();
 
-            for (uint32_t i = 1; i < traits::NumberOfExchanges<Dim>::value; ++i)
-            {
-                if (buffer.getGridBuffer().hasSendExchange(i))
-                {
-                    __startAtomicTransaction(serialEvent);
-                    FieldFactory::getInstance().createTaskFieldSendExchange(buffer, i);
-                    tmpEvent += __endTransaction();
-                }
-            }
-            state = WaitForSend;
+            /* one kernel copies the guards of all exchanges */
+            bashEvent = buffer.getGridBuffer().asyncBashSendExchanges(
+                serialEvent,
+                buffer.getGridBuffer().getSendMask(),
+                GUARD);
+            state = WaitForBash;
         }
 
         bool executeIntern()
@@ -68,6 +64,23 @@ namespace PMacc
             {
                 case Init:
                     break;
+                case WaitForBash:
+                    if (NULL == Environment<>::get().Manager().getITaskIfNotFinished(bashEvent.getTaskId()))
+                    {
+                        state = InitSend;
+                        for (uint32_t i = 1; i < traits::NumberOfExchanges<Dim>::value; ++i)
+                        {
+                            if (buffer.getGridBuffer().hasSendExchange(i))
+                            {
+                                copyEvents[i] = bashEvent;
+                                tmpEvent += buffer.getGridBuffer().asyncSend(EventTask(), i, copyEvents[i]);
+                            }
+                        }
+                        state = WaitForSend;
+                    }
+                    break;
+                case InitSend:
+                    break;
                 case WaitForSend:
                     return NULL == Environment<>::get().Manager().getITaskIfNotFinished(tmpEvent.getTaskId());
                 default:
@@ -95,6 +108,8 @@ namespace PMacc
         {
             Constructor,
             Init,
+            WaitForBash,
+            InitSend,
             WaitForSend
 
         };
@@ -102,6 +117,9 @@ namespace PMacc
 
         Field& buffer;
         state_t state;
+        EventTask bashEvent;
+        /* copy events of the exchanges, written by the send tasks */
+        EventTask copyEvents[traits::NumberOfExchanges<Dim>::value];
         EventTask tmpEvent;
     };
 
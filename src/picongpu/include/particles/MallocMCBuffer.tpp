@@ -54,6 +54,11 @@ void MallocMCBuffer::synchronize( )
      *         system.
      *         WORKAROUND: use native cuda calls :-(
      */
+#ifdef PMACC_ACC_CPU
+    /* the heap is a host memory pool, frames can be read without a copy */
+    this->hostBufferOffset = 0;
+    __startOperation(ITask::TASK_CUDA);
+#else
     if(!upBufHost)
     {
         upBufHost.reset(
@@ -82,6 +87,7 @@ void MallocMCBuffer::synchronize( )
         *upBufWrapperDev.get(),
         deviceHeapInfo.size);
     alpaka::wait::wait(stream);
+#endif
 }
 
 } //namespace picongpu
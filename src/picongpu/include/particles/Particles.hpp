@@ -56,6 +56,13 @@ public:
 
     void init(FieldE &fieldE, FieldB &fieldB, FieldJ &fieldJ, FieldTmp &fieldTmp);
 
+    /* push all particles, supercells with leaving particles are marked */
+    void push(uint32_t currentStep);
+
+    /* move the particles marked by push() to their new supercells */
+    void shift();
+
+    /* push and shift all particles */
     void update(uint32_t currentStep);
 
     template<typename T_GasFunctor, typename T_PositionFunctor>
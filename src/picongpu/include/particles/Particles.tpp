@@ -30,6 +30,7 @@
 
 
 #include "particles/Particles.kernel"
+#include "fields/FieldJ.kernel"
 
 #include "dataManagement/DataConnector.hpp"
 #include "mappings/kernel/AreaMapping.hpp"
@@ -51,6 +52,7 @@
 #include "fields/numericalCellTypes/YeeCell.hpp"
 
 #include "traits/Resolve.hpp"
+#include "particles/traits/GetPushPeriod.hpp"
 
 namespace picongpu
 {
@@ -71,7 +73,7 @@ datasetID( datasetID )
 
     this->particlesBuffer = new BufferType( gridLayout.getDataSpace( ), gridLayout.getGuard( ) );
 
-    log<picLog::MEMORY > ( "size for all exchange = %1% MiB" ) % ( (double) sizeOfExchanges / 1024. / 1024. );
+    log<picLog::MEMORY > ( "initial size for all exchange = %1% MiB" ) % ( (double) sizeOfExchanges / 1024. / 1024. );
 
     const uint32_t commTag = FrameType::CommunicationTag + SPECIES_FIRSTTAG;
     this->particlesBuffer->addExchange( Mask( LEFT ) + Mask( RIGHT ),
@@ -151,7 +153,20 @@ void Particles<T_ParticleDescription>::init( FieldE &fieldE, FieldB &fieldB, Fie
 }
 
 template<typename T_ParticleDescription>
-void Particles<T_ParticleDescription>::update(uint32_t )
+void Particles<T_ParticleDescription>::update(uint32_t currentStep)
+{
+    push( currentStep );
+    shift( );
+}
+
+template<typename T_ParticleDescription>
+void Particles<T_ParticleDescription>::shift( )
+{
+    ParticlesBaseType::shiftMarkedParticles( );
+}
+
+template<typename T_ParticleDescription>
+void Particles<T_ParticleDescription>::push(uint32_t currentStep)
 {
     typedef typename HasFlag<FrameType,particlePusher<> >::type hasPusher;
     typedef typename GetFlagType<FrameType,particlePusher<> >::type FoundPusher;
@@ -171,6 +186,9 @@ void Particles<T_ParticleDescription>::update(uint32_t )
         InterpolationScheme,
         fieldSolver::NumericalCellType > FrameSolver;
 
+    /* sub-cycled species are pushed with a multiple of DELTA_T */
+    const float_X deltaTime = DELTA_T * float_X( traits::GetPushPeriod<Particles>::type::getValue( ) );
+
     typedef SuperCellDescription<
         typename MappingDesc::SuperCellSize,
         LowerMargin,
@@ -179,19 +197,79 @@ void Particles<T_ParticleDescription>::update(uint32_t )
 
     DataSpace<simDim> block( MappingDesc::SuperCellSize::toRT() );
 
+    /* background fields for the pusher, see ENABLE_PUSHER_BACKGROUND_FIELDS */
+    typedef fieldBackground::PusherBackground<FieldBackgroundE> BackgroundE;
+    typedef fieldBackground::PusherBackground<FieldBackgroundB> BackgroundB;
+    const BackgroundE backgroundE( FieldBackgroundE( FieldE::getUnit( ) ), currentStep );
+    const BackgroundB backgroundB( FieldBackgroundB( FieldB::getUnit( ) ), currentStep );
+
+    this->mustShiftSuperCells.clear( );
+
+#if (ENABLE_CURRENT == 1) && (ENABLE_FUSED_PUSH_CURRENT == 1)
+    typedef typename PMacc::traits::Resolve<
+        typename GetFlagType<FrameType, current<> >::type
+        >::type ParticleCurrentSolver;
+
+    typedef ComputeCurrentPerFrame<ParticleCurrentSolver, Velocity, MappingDesc::SuperCellSize> CurrentSolver;
+
+    /* particles are deposited before they are shifted and can be one cell
+     * outside of their supercell */
+    typedef typename PMacc::math::CT::make_Int<simDim, 1>::type OneCell;
+    typedef SuperCellDescription<
+        typename MappingDesc::SuperCellSize,
+        typename PMacc::math::CT::add<typename GetMargin<ParticleCurrentSolver>::LowerMargin, OneCell>::type,
+        typename PMacc::math::CT::add<typename GetMargin<ParticleCurrentSolver>::UpperMargin, OneCell>::type
+        > BlockAreaJ;
+
+    typedef typename ParticlesBaseType::ActiveSuperCellListType ActiveList;
+    ActiveList& activeList = this->getActiveSuperCells( );
+
+    /* each stride class writes disjoint parts of the current, see FieldJ::computeCurrent */
+    __startAtomicTransaction( __getTransactionEvent( ) );
+    for ( uint32_t stride = 0; stride < ActiveList::NumStrides; ++stride )
+    {
+        typename ActiveList::Mapping strideMapper( activeList.getStrideMapping( stride ) );
+        if ( strideMapper.getSize( ) == 0 )
+            continue;
+
+        KernelMoveMarkAndDepositCurrent<BlockArea, BlockAreaJ> kernelMoveMarkAndDepositCurrent;
+        __cudaKernelSuperCell(
+            kernelMoveMarkAndDepositCurrent,
+            alpaka::dim::DimInt<simDim>,
+            strideMapper.getGridDim( ),
+            block)(
+                this->getDeviceParticlesBox( ),
+                this->fieldE->getDeviceDataBox( ),
+                this->fieldB->getDeviceDataBox( ),
+                this->fieldJurrent->getDeviceDataBox( ),
+                backgroundE,
+                backgroundB,
+                FrameSolver( deltaTime ),
+                CurrentSolver( deltaTime ),
+                this->mustShiftSuperCells.getDeviceDataBox( ),
+                strideMapper );
+    }
+    __setTransactionEvent( __endTransaction( ) );
+#else
+    /* supercells without particles are skipped */
+    typename ParticlesBaseType::ActiveSuperCellListType::Mapping activeMapper(
+        this->getActiveSuperCells( ).getMapping( ) );
+
     KernelMoveAndMarkParticles<BlockArea> kernelMoveAndMarkParticles;
-    __picKernelArea(
+    __picKernelListSuperCell(
         kernelMoveAndMarkParticles,
         alpaka::dim::DimInt<simDim>,
-        this->cellDescription,
+        activeMapper,
         CORE + BORDER,
         block)(
             this->getDeviceParticlesBox( ),
             this->fieldE->getDeviceDataBox( ),
             this->fieldB->getDeviceDataBox( ),
-            FrameSolver( ));
-
-    ParticlesBaseType::template shiftParticles < CORE + BORDER > ( );
+            backgroundE,
+            backgroundB,
+            FrameSolver( deltaTime ),
+            this->mustShiftSuperCells.getDeviceDataBox( ));
+#endif
 }
 
 template< typename T_ParticleDescription>
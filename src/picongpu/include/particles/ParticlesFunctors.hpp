@@ -30,6 +30,7 @@
 #include <boost/mpl/accumulate.hpp>
 
 #include "particles/traits/GetIonizer.hpp"
+#include "particles/traits/GetPushPeriod.hpp"
 
 namespace picongpu
 {
@@ -126,8 +127,56 @@ struct CallReset
     }
 };
 
+/** push all particles of a species on the stream of the species
+ *
+ * The push of each species is enqueued in its own stream, the species
+ * are only ordered by serialEvent. The event of the push is stored in the
+ * species and used by CallShiftAndCommunicate.
+ * Sub-cycled species (see `pushPeriod<>`) are skipped between their pushes.
+ */
 template<typename T_SpeciesName>
-struct CallUpdate
+struct CallPush
+{
+    typedef T_SpeciesName SpeciesName;
+    typedef typename SpeciesName::type SpeciesType;
+    typedef typename SpeciesType::FrameType FrameType;
+
+    template<typename T_StorageTuple, typename T_Event>
+    HINLINE void operator()(
+                            T_StorageTuple& tuple,
+                            const uint32_t currentStep,
+                            const uint32_t sortPeriod,
+                            T_Event& serialEvent
+                            ) const
+    {
+        typedef typename HasFlag<FrameType, particlePusher<> >::type hasPusher;
+        if (hasPusher::value && traits::isPushStep<SpeciesType>(currentStep))
+        {
+            PMACC_AUTO(speciesPtr, tuple[SpeciesName()]);
+
+            __startStreamTransaction(serialEvent, speciesPtr->getEventStream());
+            /* sorted and packed frames improve the memory access of the pusher */
+            if (sortPeriod != 0 && currentStep % sortPeriod == 0)
+                speciesPtr->sortAllParticles();
+            speciesPtr->push(currentStep);
+            const T_Event pushEvent = __endTransaction();
+            speciesPtr->setStreamEvent(pushEvent);
+#if (ENABLE_CURRENT == 1) && (ENABLE_FUSED_PUSH_CURRENT == 1)
+            /* the fused push adds to fieldJ, pushes of different species must not overlap */
+            serialEvent = pushEvent;
+#endif
+        }
+    }
+};
+
+/** shift and communicate all particles of a species after CallPush
+ *
+ * Runs on the stream of the species and waits only for the push of the
+ * same species. Other species are joined by the caller via updateEvent
+ * and commEvent.
+ */
+template<typename T_SpeciesName>
+struct CallShiftAndCommunicate
 {
     typedef T_SpeciesName SpeciesName;
     typedef typename SpeciesName::type SpeciesType;
@@ -137,18 +186,17 @@ struct CallUpdate
     HINLINE void operator()(
                             T_StorageTuple& tuple,
                             const uint32_t currentStep,
-                            const T_Event eventInt,
                             T_Event& updateEvent,
                             T_Event& commEvent
                             ) const
     {
         typedef typename HasFlag<FrameType, particlePusher<> >::type hasPusher;
-        if (hasPusher::value)
+        if (hasPusher::value && traits::isPushStep<SpeciesType>(currentStep))
         {
             PMACC_AUTO(speciesPtr, tuple[SpeciesName()]);
 
-            __startTransaction(eventInt);
-            speciesPtr->update(currentStep);
+            __startStreamTransaction(speciesPtr->getStreamEvent(), speciesPtr->getEventStream());
+            speciesPtr->shift();
             commEvent += speciesPtr->asyncCommunication(__getTransactionEvent());
             updateEvent += __endTransaction();
         }
@@ -208,14 +256,17 @@ struct CallIonization
              *        while cycling through the particle frames
              *
              * kernel call : instead of name<<<blocks, threads>>> (args, ...)
-             * "blocks" will be calculated from "this->cellDescription" and "CORE + BORDER"
+             * "blocks" are the supercells with particles of the source species
              * "threads" is calculated from the previously defined vector "block"
              */
+            typename SpeciesType::ActiveSuperCellListType::Mapping activeMapper(
+                srcSpeciesPtr->getActiveSuperCells( ).getMapping( ) );
+
             particles::ionization::KernelIonizeParticles kernelIonizeParticles;
-            __picKernelArea(
+            __picKernelList(
                 kernelIonizeParticles,
                 alpaka::dim::DimInt<simDim>,
-                *cellDesc,
+                activeMapper,
                 CORE + BORDER,
                 block)(
                     srcSpeciesPtr->getDeviceParticlesBox( ),
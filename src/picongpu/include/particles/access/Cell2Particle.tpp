@@ -61,10 +61,12 @@ BOOST_PP_ENUM_TRAILING(N, NORMAL_ARGS, _)) \
     \
     while (isValid) \
     { \
-        if (linearThreadIdx < particlesInSuperCell) \
+        /* a frame can hold more or less particles than cells in a supercell */ \
+        for (int particleIdx = linearThreadIdx; particleIdx < particlesInSuperCell; \
+             particleIdx += PMacc::math::CT::volume<SuperCellSize>::type::value) \
         { \
             functor( \
-                frame, linearThreadIdx \
+                frame, particleIdx \
                 BOOST_PP_ENUM_TRAILING(N, ARGS, _) \
                 ); \
         } \
@@ -72,7 +74,7 @@ BOOST_PP_ENUM_TRAILING(N, NORMAL_ARGS, _)) \
         if (linearThreadIdx == 0) \
         { \
             frame = &(pb.getPreviousFrame(*frame, isValid)); \
-            particlesInSuperCell = PMacc::math::CT::volume<SuperCellSize>::type::value; \
+            particlesInSuperCell = Frame::FrameSize::value; \
         } \
         alpaka::block::sync::syncBlockThreads(acc); \
     } \
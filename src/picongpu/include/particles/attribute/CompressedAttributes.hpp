@@ -0,0 +1,129 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "simulation_defines.hpp"
+#include "math/Vector.hpp"
+
+namespace picongpu
+{
+namespace attribute
+{
+
+/** in-cell position stored as 16 bit fixed point number per component
+ *
+ * The position in [0,1) is split into 2^16 bins, a stored position is
+ * decoded to the center of its bin. Positions outside of [0,1) are
+ * clamped, therefore only the position after the push (in cell range)
+ * may be stored.
+ *
+ * The type converts implicitly from and to the float vector, kernels
+ * decode the position once into a register, e.g.
+ * `floatD_X pos = particle[position_];`
+ *
+ * The charge conserving current solvers rebuild the old position from the
+ * new one and the velocity. With a quantized position the rebuilt position
+ * differs from the stored old one by up to half a bin, therefore the
+ * current is deposited by the fused push and current kernel
+ * (ENABLE_FUSED_PUSH_CURRENT 1) which keeps the decoded old position in
+ * registers and deposits the move between both decoded positions.
+ *
+ * hdf5 and adios write and read the decoded position (see DecodedType).
+ */
+template<unsigned T_dim>
+struct FixedPointPosition
+{
+    typedef PMacc::math::Vector<float_X, T_dim> VectorType;
+
+    static constexpr uint32_t numBins = 1u << 16;
+
+    HDINLINE FixedPointPosition()
+    {
+    }
+
+    HDINLINE FixedPointPosition(const VectorType& pos)
+    {
+        *this = pos;
+    }
+
+    HDINLINE FixedPointPosition& operator=(const VectorType& pos)
+    {
+        for (uint32_t d = 0; d < T_dim; ++d)
+        {
+            const float_X bin = math::floor(pos[d] * float_X(numBins));
+            const float_X clamped = bin < float_X(0.0) ? float_X(0.0) :
+                (bin > float_X(numBins - 1) ? float_X(numBins - 1) : bin);
+            value[d] = static_cast<uint16_t>(clamped);
+        }
+        return *this;
+    }
+
+    HDINLINE float_X operator[](const uint32_t d) const
+    {
+        return (float_X(value[d]) + float_X(0.5)) * (float_X(1.0) / float_X(numBins));
+    }
+
+    HDINLINE operator VectorType() const
+    {
+        VectorType pos;
+        for (uint32_t d = 0; d < T_dim; ++d)
+            pos[d] = (*this)[d];
+        return pos;
+    }
+
+    uint16_t value[T_dim];
+};
+
+/** true if a frame attribute type is a compressed storage type
+ */
+template<typename T_Type>
+struct IsCompressedStorage
+{
+    static const bool value = false;
+};
+
+template<unsigned T_dim>
+struct IsCompressedStorage<FixedPointPosition<T_dim> >
+{
+    static const bool value = true;
+};
+
+/** type a frame attribute is decoded to
+ *
+ * Compressed types have no counterpart in the file formats, plugins which
+ * copy attributes one by one (hdf5, adios, restart) convert them to and
+ * from this type.
+ */
+template<typename T_Type>
+struct DecodedType
+{
+    typedef T_Type type;
+};
+
+template<unsigned T_dim>
+struct DecodedType<FixedPointPosition<T_dim> >
+{
+    typedef typename FixedPointPosition<T_dim>::VectorType type;
+};
+
+} //namespace attribute
+} //namespace picongpu
@@ -28,6 +28,7 @@
 
 #include "fields/FieldB.hpp"
 #include "fields/FieldE.hpp"
+#include "fields/background/PusherBackground.hpp"
 
 #include "particles/ionization/byField/BSI/BSI.def"
 #include "particles/ionization/byField/BSI/AlgorithmBSI.hpp"
@@ -90,13 +91,18 @@ namespace ionization
             /* global memory EM-field device databoxes */
             FieldE::DataBoxType eBox;
             FieldB::DataBoxType bBox;
+            /* background fields for the pusher, see ENABLE_PUSHER_BACKGROUND_FIELDS */
+            fieldBackground::PusherBackground<FieldBackgroundE> backgroundE;
+            fieldBackground::PusherBackground<FieldBackgroundB> backgroundB;
             /* shared memory EM-field device databoxes */
             PMACC_ALIGN(cachedE, DataBox<SharedBox<ValueType_E, typename BlockArea::FullSuperCellSize,1> >);
             PMACC_ALIGN(cachedB, DataBox<SharedBox<ValueType_B, typename BlockArea::FullSuperCellSize,0> >);
 
         public:
             /* host constructor */
-            BSI_Impl(const uint32_t currentStep)
+            BSI_Impl(const uint32_t currentStep) :
+                backgroundE(FieldBackgroundE(FieldE::getUnit()), currentStep),
+                backgroundB(FieldBackgroundB(FieldB::getUnit()), currentStep)
             {
                 DataConnector &dc = Environment<>::get().DataConnector();
                 /* initialize pointers on host-side E-(B-)field databoxes */
@@ -131,23 +137,14 @@ namespace ionization
                 cachedE = CachedBox::create < 1, ValueType_E > (acc, BlockArea());
                 /* wait for shared memory to be initialized */
                 alpaka::block::sync::syncBlockThreads(acc);
-                /* instance of nvidia assignment operator */
-                nvidia::functors::Assign assign;
-                /* copy fields from global to shared */
+                /* copy fields from global to shared,
+                 * background fields for the pusher are added to the cache */
                 PMACC_AUTO(fieldBBlock, bBox.shift(blockCell));
                 ThreadCollective<BlockArea> collective(linearThreadIdx);
-                collective(
-                          assign,
-                          cachedB,
-                          fieldBBlock
-                          );
+                backgroundB.load(collective, cachedB, fieldBBlock, blockCell);
                 /* copy fields from global to shared */
                 PMACC_AUTO(fieldEBlock, eBox.shift(blockCell));
-                collective(
-                          assign,
-                          cachedE,
-                          fieldEBlock
-                          );
+                backgroundE.load(collective, cachedE, fieldEBlock, blockCell);
             }
 
             /** Functor implementation
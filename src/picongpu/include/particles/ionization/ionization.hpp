@@ -101,6 +101,12 @@ ALPAKA_FN_ACC void operator()(
     /* definitions for domain variables, like indices of blocks and threads */
     typedef typename BlockDescription_::SuperCellSize SuperCellSize;
 
+    /* each thread owns one slot of an ion frame */
+    static_assert(
+        IONFRAME::FrameSize::value == PMacc::math::CT::volume<SuperCellSize>::type::value &&
+        ELECTRONFRAME::FrameSize::value == PMacc::math::CT::volume<SuperCellSize>::type::value,
+        "ionization requires ion and electron frames of the size of a supercell");
+
     DataSpace<simDim> const blockIndex(alpaka::idx::getIdx<alpaka::Grid, alpaka::Blocks>(acc));
 
     /* 3D vector from origin of the block to a cell in units of cells */
@@ -47,9 +47,11 @@ struct AssignImpl
     template<typename T_Acc, typename T_Particle1, typename T_Particle2>
     DINLINE void operator()(const T_Acc&, const DataSpace<simDim>&,
                             T_Particle1& particleDest, T_Particle2& particleSrc,
-                            const bool, const bool)
+                            const bool isDestParticle, const bool)
     {
-        PMacc::particles::operations::assign(particleDest, particleSrc);
+        /* isDestParticle is false for slots behind the end of a frame */
+        if (isDestParticle)
+            PMacc::particles::operations::assign(particleDest, particleSrc);
     }
 
 };
@@ -57,6 +57,13 @@ struct CreateParticlesFromParticleImpl : private T_Functor
     typedef T_Functor Functor;
     static const uint32_t particlePerParticle = T_Count::value;
     static const int cellsInSuperCell = (int)PMacc::math::CT::volume<SuperCellSize>::type::value;
+    /* number of particles a frame of the destination species can hold */
+    static const int particlesPerFrame = (int)DestSpeciesType::FrameType::FrameSize::value;
+
+    /* each thread takes at most one slot per round, the overflow of a round
+     * must fit into one new frame */
+    static_assert(particlesPerFrame >= cellsInSuperCell,
+                  "the frame size of the destination species must not be smaller than a supercell");
 
     HINLINE CreateParticlesFromParticleImpl(uint32_t currentStep) : Functor(currentStep)
     {
@@ -104,7 +111,7 @@ struct CreateParticlesFromParticleImpl : private T_Functor
                 {
                     particlesInDestSuperCell = destParBox.getSuperCell(superCell).getSizeLastFrame();
                 }
-                if (!isValid || particlesInDestSuperCell == cellsInSuperCell)
+                if (!isValid || particlesInDestSuperCell == particlesPerFrame)
                 {
                     destFrame = &(destParBox.getEmptyFrame());
                     destParBox.setAsLastFrame(acc, *destFrame, superCell);
@@ -130,7 +137,7 @@ struct CreateParticlesFromParticleImpl : private T_Functor
                 freeSlot = alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &particlesInDestSuperCell, 1);
             }
             --numParToCreate;
-            if (freeSlot>-1 && freeSlot < cellsInSuperCell)
+            if (freeSlot>-1 && freeSlot < particlesPerFrame)
             {
                 PMACC_AUTO(destParticle, (*destFrame)[freeSlot]);
                 Functor::operator()(destParticle, particle);
@@ -142,9 +149,9 @@ struct CreateParticlesFromParticleImpl : private T_Functor
 
             if (ltid == 0)
             {
-                if (particlesInDestSuperCell >= cellsInSuperCell)
+                if (particlesInDestSuperCell >= particlesPerFrame)
                 {
-                    particlesInDestSuperCell -= cellsInSuperCell;
+                    particlesInDestSuperCell -= particlesPerFrame;
                     destFrame = &(destParBox.getEmptyFrame());
                     destParBox.setAsLastFrame(acc, *destFrame, superCell);
                 }
@@ -152,9 +159,9 @@ struct CreateParticlesFromParticleImpl : private T_Functor
             alpaka::block::sync::syncBlockThreads(acc);
 
             //second flush
-            if (freeSlot >= cellsInSuperCell)
+            if (freeSlot >= particlesPerFrame)
             {
-                PMACC_AUTO(destParticle, (*destFrame)[freeSlot - cellsInSuperCell]);
+                PMACC_AUTO(destParticle, (*destFrame)[freeSlot - particlesPerFrame]);
                 Functor::operator()(destParticle, particle);
             }
             alpaka::block::sync::syncBlockThreads(acc);
@@ -75,12 +75,13 @@ namespace picongpu
                 PosType & pos, /* at t=0 */
                 MomType & mom, /* at t=-1/2 */
                 MassType const & mass,
-                ChargeType const & charge) const
+                ChargeType const & charge,
+                const float_X deltaTime) const
             {
                 Gamma gammaCalc;
                 Velocity velocityCalc;
                 const float_X epsilon = 1.0e-6;
-                const float_X deltaT = DELTA_T;
+                const float_X deltaT = deltaTime;
 
                 //const float3_X velocity_atMinusHalf = velocity(mom, mass);
                 const float_X gamma = gammaCalc( mom, mass );
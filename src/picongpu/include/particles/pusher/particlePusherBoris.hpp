@@ -47,11 +47,12 @@ struct Push
         PosType & pos,
         MomType & mom,
         MassType const & mass,
-        ChargeType const & charge) const
+        ChargeType const & charge,
+        const float_X deltaTime) const
     {
         const float_X QoM = charge / mass;
 
-        const float_X deltaT = DELTA_T;
+        const float_X deltaT = deltaTime;
 
         const MomType mom_minus = mom + float_X(0.5) * charge * eField * deltaT;
 
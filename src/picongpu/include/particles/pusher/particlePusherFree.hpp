@@ -45,7 +45,8 @@ namespace picongpu
                 PosType & pos,
                 MomType const & mom,
                 MassType const & mass,
-                ChargeType const & charge) const
+                ChargeType const & charge,
+                const float_X deltaTime) const
             {
 
                 Velocity velocity;
@@ -54,7 +55,7 @@ namespace picongpu
 
                 for(uint32_t d=0;d<simDim;++d)
                 {
-                    pos[d] += (vel[d] * DELTA_T) / cellSize[d];
+                    pos[d] += (vel[d] * deltaTime) / cellSize[d];
                 }
             }
         };
@@ -45,7 +45,8 @@ namespace picongpu
                 PosType & pos, /* at t=0 */
                 MomType & mom, /* at t=-1/2 */
                 MassType const & mass,
-                ChargeType const & charge) const
+                ChargeType const & charge,
+                const float_X deltaTime) const
             {}
         };
     } //namespace
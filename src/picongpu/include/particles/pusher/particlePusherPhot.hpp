@@ -45,7 +45,8 @@ namespace picongpu
                 PosType & pos,
                 MomType & mom,
                 MassType const & mass,
-                ChargeType const & charge) const
+                ChargeType const & charge,
+                const float_X deltaTime) const
             {
 
                 const float_X mom_abs = abs( mom );
@@ -53,7 +54,7 @@ namespace picongpu
 
                 for(uint32_t d=0;d<simDim;++d)
                 {
-                    pos[d] += (vel[d] * DELTA_T) / cellSize[d];
+                    pos[d] += (vel[d] * deltaTime) / cellSize[d];
                 }
             }
         };
@@ -48,7 +48,8 @@ struct Push
         PosType & pos, /* at t=0 */
         MomType & mom, /* at t=-1/2 */
         MassType const & mass,
-        ChargeType const & charge) const
+        ChargeType const & charge,
+        const float_X deltaTime) const
     {
 
         /*
@@ -58,7 +59,7 @@ struct Push
      Here the real (PIConGPU) momentum (p) is used, not the momentum from the Vay paper (u)
      p = m_0 * u
          */
-        const float_X deltaT = DELTA_T;
+        const float_X deltaT = deltaTime;
         const float_X factor = 0.5 * charge * deltaT;
         Gamma gamma;
         Velocity velocity;
@@ -91,7 +92,7 @@ struct Push
 
         for(uint32_t d=0;d<simDim;++d)
         {
-            pos[d] += (vel[d] * DELTA_T) / cellSize[d];
+            pos[d] += (vel[d] * deltaTime) / cellSize[d];
         }
     }
 };
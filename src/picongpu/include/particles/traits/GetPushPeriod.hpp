@@ -0,0 +1,78 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "simulation_defines.hpp"
+#include "traits/GetFlagType.hpp"
+#include "traits/Resolve.hpp"
+
+#include <boost/mpl/if.hpp>
+
+namespace picongpu
+{
+namespace traits
+{
+
+namespace detail
+{
+    value_identifier(uint32_t, DefaultPushPeriod, 1);
+} //namespace detail
+
+
+/** get the push period of a species
+ *
+ * period is set to 1 (push every time step) if no alias `pushPeriod<>`
+ * is defined
+ *
+ * @treturn ::type `value_identifier` with the push period
+ */
+template<typename T_Species>
+struct GetPushPeriod
+{
+    typedef typename T_Species::FrameType FrameType;
+    typedef typename HasFlag<FrameType, pushPeriod<> >::type hasPushPeriod;
+    typedef typename PMacc::traits::Resolve<
+        typename GetFlagType<
+            FrameType, pushPeriod<>
+        >::type
+    >::type PushPeriodOfSpecies;
+
+    typedef typename bmpl::if_<
+         hasPushPeriod,
+        PushPeriodOfSpecies,
+        detail::DefaultPushPeriod
+    >::type type;
+};
+
+/** check if a species is pushed in a time step
+ *
+ * @param currentStep current simulation time step
+ */
+template<typename T_Species>
+HINLINE bool isPushStep(const uint32_t currentStep)
+{
+    const uint32_t period = GetPushPeriod<T_Species>::type::getValue();
+    return currentStep % period == 0;
+}
+
+} //namespace traits
+
+}// namespace picongpu
@@ -117,9 +117,10 @@ ALPAKA_FN_ACC void operator()(
 
     while (isValid)
     {
-        if (linearThreadIdx < particlesInSuperCell)
+        /* a frame can hold more or less particles than cells in a supercell */
+        for (int particleIdx = linearThreadIdx; particleIdx < particlesInSuperCell; particleIdx += threads)
         {
-            PMACC_AUTO(particle,(*frame)[linearThreadIdx]);
+            PMACC_AUTO(particle,(*frame)[particleIdx]);
             /* kinetic Energy for Particles: E^2 = p^2*c^2 + m^2*c^4
              *                                   = c^2 * [p^2 + m^2*c^2] */
             const float3_X mom = particle[momentum_];
@@ -189,7 +190,7 @@ ALPAKA_FN_ACC void operator()(
         if (linearThreadIdx == 0)
         {
             frame = &(pb.getPreviousFrame(*frame, isValid));
-            particlesInSuperCell = PMacc::math::CT::volume<Block>::type::value;
+            particlesInSuperCell = FRAME::FrameSize::value;
         }
         alpaka::block::sync::syncBlockThreads(acc);
     }
@@ -461,11 +462,16 @@ private:
         const float_X minEnergy = minEnergy_keV * UNITCONV_keV_to_Joule / UNIT_ENERGY;
         const float_X maxEnergy = maxEnergy_keV * UNITCONV_keV_to_Joule / UNIT_ENERGY;
 
+        /* the active list holds all supercells with particles in CORE and BORDER */
+        static_assert(AREA == CORE + BORDER, "BinEnergyParticles supports only CORE + BORDER");
+        typename ParticlesType::ActiveSuperCellListType::Mapping activeMapper(
+            particles->getActiveSuperCells().getMapping());
+
         KernelBinEnergyParticles kernelBinEnergyParticles;
-        __picKernelArea(
+        __picKernelList(
             kernelBinEnergyParticles,
             alpaka::dim::DimInt<simDim>,
-            *cellDescription,
+            activeMapper,
             AREA,
             block)
             (particles->getDeviceParticlesBox(),
@@ -82,6 +82,7 @@ ALPAKA_FN_ACC void operator()(
     typedef typename Mapping::SuperCellSize SuperCellSize;
 
     const int linearThreadIdx = DataSpaceOperations<simDim>::template map<SuperCellSize > (threadIndex);
+    const int cellsPerSuperCell = PMacc::math::CT::volume<SuperCellSize>::type::value;
 
     if (linearThreadIdx == 0) /* only thread 0 runs initial set up */
     {
@@ -95,48 +96,54 @@ ALPAKA_FN_ACC void operator()(
     if (!isValid)
         return; /* end kernel if we have no frames */
 
-    /* this checks if the data loaded by a thread is filled with a particle
-     * or not. Only applies to the first loaded frame (=last frame) */
-    /* BUGFIX to issue #538
-     * volatile prohibits that the compiler creates wrong code*/
-    volatile bool isParticle = (*frame)[linearThreadIdx][multiMask_];
+    /* only the first visited (=last) frame can have gaps */
+    bool isLastFrame = true;
 
     while (isValid)
     {
-        if (isParticle)
+        /* a frame can hold more or less particles than cells in a supercell */
+        for (int particleIdx = linearThreadIdx; particleIdx < (int) FRAME::FrameSize::value; particleIdx += cellsPerSuperCell)
         {
+            /* this checks if the data loaded by a thread is filled with a particle
+             * or not. Only applies to the first loaded frame (=last frame) */
+            /* BUGFIX to issue #538
+             * volatile prohibits that the compiler creates wrong code*/
+            volatile bool isParticle = !isLastFrame || (*frame)[particleIdx][multiMask_];
+            if (isParticle)
+            {
 
-            PMACC_AUTO(particle,(*frame)[linearThreadIdx]); /* get one particle */
-            const float3_X mom = particle[momentum_]; /* get particle momentum */
-            /* and compute square of absolute momentum of one particle: */
-            const float_X mom2 = mom.x() * mom.x() + mom.y() * mom.y() + mom.z() * mom.z();
+                PMACC_AUTO(particle,(*frame)[particleIdx]); /* get one particle */
+                const float3_X mom = particle[momentum_]; /* get particle momentum */
+                /* and compute square of absolute momentum of one particle: */
+                const float_X mom2 = mom.x() * mom.x() + mom.y() * mom.y() + mom.z() * mom.z();
 
-            const float_X weighting = particle[weighting_]; /* get macro particle weighting */
-            const float_X mass = attribute::getMass(weighting,particle); /* compute mass using weighting */
-            const float_X c2 = SPEED_OF_LIGHT * SPEED_OF_LIGHT;
+                const float_X weighting = particle[weighting_]; /* get macro particle weighting */
+                const float_X mass = attribute::getMass(weighting,particle); /* compute mass using weighting */
+                const float_X c2 = SPEED_OF_LIGHT * SPEED_OF_LIGHT;
 
-            Gamma<> calcGamma; /* functor for computing relativistic gamma factor */
-            const float_X gamma = calcGamma(mom, mass); /* compute relativistic gamma */
+                Gamma<> calcGamma; /* functor for computing relativistic gamma factor */
+                const float_X gamma = calcGamma(mom, mass); /* compute relativistic gamma */
 
-            if (gamma < GAMMA_THRESH) /* if particle energy is low enough: */
-            {
-                /* not relativistic: use equation with more precision */
-                _local_energyKin += mom2 / (2.0f * mass);
-            }
-            else /* if particle is relativistic */
-            {
-                /* kinetic energy for particles: E = (gamma - 1) * m * c^2
-                 *                                    gamma = sqrt( 1 + (p/m/c)^2 )
-                 * _local_energyKin += (sqrtf(mom2 / (mass * mass * c2) + 1.) - 1.) * mass * c2;
-                 */
-                _local_energyKin += (gamma - float_X(1.0)) * mass*c2;
-            }
+                if (gamma < GAMMA_THRESH) /* if particle energy is low enough: */
+                {
+                    /* not relativistic: use equation with more precision */
+                    _local_energyKin += mom2 / (2.0f * mass);
+                }
+                else /* if particle is relativistic */
+                {
+                    /* kinetic energy for particles: E = (gamma - 1) * m * c^2
+                     *                                    gamma = sqrt( 1 + (p/m/c)^2 )
+                     * _local_energyKin += (sqrtf(mom2 / (mass * mass * c2) + 1.) - 1.) * mass * c2;
+                     */
+                    _local_energyKin += (gamma - float_X(1.0)) * mass*c2;
+                }
 
-            /* total energy for particles: E^2 = p^2*c^2 + m^2*c^4
-             *                                   = c^2 * [p^2 + m^2*c^2]
-             */
-            _local_energy += sqrtf(mom2 + mass * mass * c2) * SPEED_OF_LIGHT;
+                /* total energy for particles: E^2 = p^2*c^2 + m^2*c^4
+                 *                                   = c^2 * [p^2 + m^2*c^2]
+                 */
+                _local_energy += sqrtf(mom2 + mass * mass * c2) * SPEED_OF_LIGHT;
 
+            }
         }
         alpaka::block::sync::syncBlockThreads(acc); /* wait till all threads have added their particle energies */
 
@@ -146,7 +153,7 @@ ALPAKA_FN_ACC void operator()(
             /* set frame to next particle frame */
             frame = &(pb.getPreviousFrame(*frame, isValid));
         }
-        isParticle = true; /* all following frames are filled with particles */
+        isLastFrame = false; /* all following frames are filled with particles */
         alpaka::block::sync::syncBlockThreads(acc); /* wait till thread 0 is done */
     }
 
@@ -324,11 +331,16 @@ private:
         gEnergy->getDeviceBuffer().setValue(0.0); /* init global energy with zero */
         DataSpace<simDim> block(MappingDesc::SuperCellSize::toRT()); /* GPU parallelization */
 
+        /* the active list holds all supercells with particles in CORE and BORDER */
+        static_assert(AREA == CORE + BORDER, "EnergyParticles supports only CORE + BORDER");
+        typename ParticlesType::ActiveSuperCellListType::Mapping activeMapper(
+            particles->getActiveSuperCells().getMapping());
+
         /* kernel call = sum all particle energies on GPU */
-        __picKernelArea(
+        __picKernelList(
             kernelEnergyParticles,
             alpaka::dim::DimInt<simDim>,
-            *cellDescription,
+            activeMapper,
             AREA,
             block)(
                 particles->getDeviceParticlesBox(),
@@ -120,6 +120,7 @@ ALPAKA_FN_ACC void operator()(
     typedef typename Mapping::SuperCellSize SuperCellSize;
 
     const int linearThreadIdx = DataSpaceOperations<simDim>::template map<SuperCellSize > (threadIndex);
+    const int cellsPerSuperCell = PMacc::math::CT::volume<SuperCellSize>::type::value;
     const DataSpace<simDim> superCellIdx(mapper.getSuperCellIndex(DataSpace<simDim > (blockIndex)));
 
     if (linearThreadIdx == 0)
@@ -131,39 +132,45 @@ ALPAKA_FN_ACC void operator()(
     if (!isValid)
         return; //end kernel if we have no frames
 
-    /* BUGFIX to issue #538
-     * volatile prohibits that the compiler creates wrong code*/
-    volatile bool isParticle = (*frame)[linearThreadIdx][multiMask_];
+    /* only the first visited (=last) frame can have gaps */
+    bool isLastFrame = true;
 
     while (isValid)
     {
-        if (isParticle)
+        /* a frame can hold more or less particles than cells in a supercell */
+        for (int particleIdx = linearThreadIdx; particleIdx < (int) FRAME::FrameSize::value; particleIdx += cellsPerSuperCell)
         {
-            PMACC_AUTO(particle,(*frame)[linearThreadIdx]);
-            gParticle->position = particle[position_];
-            gParticle->momentum = particle[momentum_];
-            gParticle->weighting = particle[weighting_];
-            gParticle->mass = attribute::getMass(gParticle->weighting,particle);
-            gParticle->charge = attribute::getCharge(gParticle->weighting,particle);
-            gParticle->gamma = Gamma<>()(gParticle->momentum, gParticle->mass);
-
-            // storage number in the actual frame
-            const lcellId_t frameCellNr = particle[localCellIdx_];
-
-            // offset in the actual superCell = cell offset in the supercell
-            const DataSpace<simDim> frameCellOffset(DataSpaceOperations<simDim>::template map<MappingDesc::SuperCellSize > (frameCellNr));
-
-
-            gParticle->globalCellOffset = (superCellIdx - mapper.getGuardingSuperCells())
-                * MappingDesc::SuperCellSize::toRT()
-                + frameCellOffset;
+            /* BUGFIX to issue #538
+             * volatile prohibits that the compiler creates wrong code*/
+            volatile bool isParticle = !isLastFrame || (*frame)[particleIdx][multiMask_];
+            if (isParticle)
+            {
+                PMACC_AUTO(particle,(*frame)[particleIdx]);
+                gParticle->position = particle[position_];
+                gParticle->momentum = particle[momentum_];
+                gParticle->weighting = particle[weighting_];
+                gParticle->mass = attribute::getMass(gParticle->weighting,particle);
+                gParticle->charge = attribute::getCharge(gParticle->weighting,particle);
+                gParticle->gamma = Gamma<>()(gParticle->momentum, gParticle->mass);
+
+                // storage number in the actual frame
+                const lcellId_t frameCellNr = particle[localCellIdx_];
+
+                // offset in the actual superCell = cell offset in the supercell
+                const DataSpace<simDim> frameCellOffset(DataSpaceOperations<simDim>::template map<MappingDesc::SuperCellSize > (frameCellNr));
+
+
+                gParticle->globalCellOffset = (superCellIdx - mapper.getGuardingSuperCells())
+                    * MappingDesc::SuperCellSize::toRT()
+                    + frameCellOffset;
+            }
         }
         alpaka::block::sync::syncBlockThreads(acc);
         if (linearThreadIdx == 0)
         {
             frame = &(pb.getPreviousFrame(*frame, isValid));
         }
-        isParticle = true;
+        isLastFrame = false;
         alpaka::block::sync::syncBlockThreads(acc);
     }
 }
@@ -264,11 +271,16 @@ private:
         gParticle->getDeviceBuffer().setValue(positionParticleTmp);
         DataSpace<simDim> block(SuperCellSize::toRT());
 
+        /* the active list holds all supercells with particles in CORE and BORDER */
+        static_assert(AREA == CORE + BORDER, "PositionsParticles supports only CORE + BORDER");
+        typename ParticlesType::ActiveSuperCellListType::Mapping activeMapper(
+            particles->getActiveSuperCells().getMapping());
+
         KernelPositionsParticles kernelPositionsParticles;
-        __picKernelArea(
+        __picKernelList(
             kernelPositionsParticles,
             alpaka::dim::DimInt<simDim>,
-            *cellDescription,
+            activeMapper,
             AREA,
             block)(
                 particles->getDeviceParticlesBox(),
@@ -29,6 +29,7 @@
 #include "traits/GetComponentsType.hpp"
 #include "traits/GetNComponents.hpp"
 #include "traits/Resolve.hpp"
+#include "particles/attribute/CompressedAttributes.hpp"
 
 
 namespace picongpu
@@ -65,8 +66,10 @@ struct LoadParticleAttributesFromADIOS
 
         typedef T_Identifier Identifier;
         typedef typename PMacc::traits::Resolve<Identifier>::type::type ValueType;
-        const uint32_t components = GetNComponents<ValueType>::value;
-        typedef typename GetComponentsType<ValueType>::type ComponentType;
+        /* compressed attributes are stored decoded in the file */
+        typedef typename attribute::DecodedType<ValueType>::type FileType;
+        const uint32_t components = GetNComponents<FileType>::value;
+        typedef typename GetComponentsType<FileType>::type ComponentType;
 
         log<picLog::INPUT_OUTPUT > ("ADIOS: ( begin ) load species attribute: %1%") % Identifier::getName();
 
@@ -76,6 +79,13 @@ struct LoadParticleAttributesFromADIOS
         if( elements > 0 )
             tmpArray = new ComponentType[elements];
 
+        /* compressed attributes are assembled decoded and encoded at the end */
+        const bool isCompressed = attribute::IsCompressedStorage<ValueType>::value;
+        ValueType* dataPtr = frame.getIdentifier(Identifier()).getPointer();
+        FileType* filePtr = (FileType*) dataPtr;
+        if( isCompressed && elements > 0 )
+            filePtr = new FileType[elements];
+
         // dev assert!
         if( elements > 0 )
             assert(tmpArray);
@@ -87,8 +97,6 @@ struct LoadParticleAttributesFromADIOS
             if (components > 1)
                 datasetName << "/" << name_lookup[n];
 
-            ValueType* dataPtr = frame.getIdentifier(Identifier()).getPointer();
-
             ADIOS_VARINFO* varInfo = adios_inq_var( params->fp, datasetName.str().c_str() );
             // it's possible to aquire the local block with that call again and
             // the local elements to-be-read, but the block-ID must be known (MPI rank?)
@@ -119,7 +127,7 @@ struct LoadParticleAttributesFromADIOS
             #pragma omp parallel for
             for (size_t i = 0; i < elements; ++i)
             {
-                ComponentType& ref = ((ComponentType*) dataPtr)[i * components + n];
+                ComponentType& ref = ((ComponentType*) filePtr)[i * components + n];
                 ref = tmpArray[i];
             }
 
@@ -128,6 +136,14 @@ struct LoadParticleAttributesFromADIOS
         }
         __deleteArray(tmpArray);
 
+        if( isCompressed && elements > 0 )
+        {
+            #pragma omp parallel for
+            for (size_t i = 0; i < elements; ++i)
+                dataPtr[i] = filePtr[i];
+            __deleteArray(filePtr);
+        }
+
         log<picLog::INPUT_OUTPUT > ("ADIOS:  ( end ) load species attribute: %1%") %
             Identifier::getName();
     }
@@ -26,6 +26,7 @@
 #include "traits/GetComponentsType.hpp"
 #include "traits/GetNComponents.hpp"
 #include "traits/Resolve.hpp"
+#include "particles/attribute/CompressedAttributes.hpp"
 
 namespace picongpu
 {
@@ -56,8 +57,10 @@ struct ParticleAttribute
 
         typedef T_Identifier Identifier;
         typedef typename PMacc::traits::Resolve<Identifier>::type::type ValueType;
-        const uint32_t components = GetNComponents<ValueType>::value;
-        typedef typename GetComponentsType<ValueType>::type ComponentType;
+        /* compressed attributes are stored decoded in the file */
+        typedef typename attribute::DecodedType<ValueType>::type FileType;
+        const uint32_t components = GetNComponents<FileType>::value;
+        typedef typename GetComponentsType<FileType>::type ComponentType;
 
         log<picLog::INPUT_OUTPUT > ("ADIOS:  (begin) write species attribute: %1%") % Identifier::getName();
 
@@ -74,7 +77,8 @@ struct ParticleAttribute
             #pragma omp parallel for
             for (size_t i = 0; i < elements; ++i)
             {
-                tmpBfr[i] = ((ComponentType*) dataPtr)[d + i * components];
+                const FileType value(dataPtr[i]);
+                tmpBfr[i] = ((const ComponentType*) &value)[d];
             }
 
             int64_t adiosAttributeVarId = *(params->adiosParticleAttrVarIds.begin());
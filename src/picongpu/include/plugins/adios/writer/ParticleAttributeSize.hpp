@@ -27,6 +27,7 @@
 #include "traits/GetComponentsType.hpp"
 #include "traits/GetNComponents.hpp"
 #include "traits/Resolve.hpp"
+#include "particles/attribute/CompressedAttributes.hpp"
 
 namespace picongpu
 {
@@ -59,8 +60,10 @@ struct ParticleAttributeSize
 
         typedef T_Identifier Identifier;
         typedef typename PMacc::traits::Resolve<Identifier>::type::type ValueType;
-        const uint32_t components = GetNComponents<ValueType>::value;
-        typedef typename GetComponentsType<ValueType>::type ComponentType;
+        /* compressed attributes are stored decoded in the file */
+        typedef typename attribute::DecodedType<ValueType>::type FileType;
+        const uint32_t components = GetNComponents<FileType>::value;
+        typedef typename GetComponentsType<FileType>::type ComponentType;
 
         typedef typename traits::PICToAdios<ComponentType> AdiosType;
 
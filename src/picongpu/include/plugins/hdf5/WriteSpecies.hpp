@@ -140,7 +140,8 @@ public:
             filter.setWindowPosition(params->localWindowToDomainOffset,
                                      params->window.localDimensions.size);
 
-            DataSpace<simDim> block(PMacc::math::CT::volume<SuperCellSize>::type::value);
+            /* one thread per frame slot */
+            DataSpace<simDim> block(FrameType::FrameSize::value);
 
             GridBuffer<int, DIM1> counterBuffer(DataSpace<DIM1>(1));
             AreaMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription));
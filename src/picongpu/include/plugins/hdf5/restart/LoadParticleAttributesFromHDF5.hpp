@@ -30,6 +30,7 @@
 #include "traits/GetComponentsType.hpp"
 #include "traits/GetNComponents.hpp"
 #include "traits/Resolve.hpp"
+#include "particles/attribute/CompressedAttributes.hpp"
 
 
 namespace picongpu
@@ -68,8 +69,10 @@ struct LoadParticleAttributesFromHDF5
 
         typedef T_Identifier Identifier;
         typedef typename PMacc::traits::Resolve<Identifier>::type::type ValueType;
-        const uint32_t components = GetNComponents<ValueType>::value;
-        typedef typename GetComponentsType<ValueType>::type ComponentType;
+        /* compressed attributes are stored decoded in the file */
+        typedef typename attribute::DecodedType<ValueType>::type FileType;
+        const uint32_t components = GetNComponents<FileType>::value;
+        typedef typename GetComponentsType<FileType>::type ComponentType;
         typedef typename PICToSplash<ComponentType>::type SplashType;
 
         log<picLog::INPUT_OUTPUT > ("HDF5:  ( begin ) load species attribute: %1%") % Identifier::getName();
@@ -80,6 +83,13 @@ struct LoadParticleAttributesFromHDF5
         if( elements > 0 )
             tmpArray = new ComponentType[elements];
 
+        /* compressed attributes are assembled decoded and encoded at the end */
+        const bool isCompressed = attribute::IsCompressedStorage<ValueType>::value;
+        ValueType* dataPtr = frame.getIdentifier(Identifier()).getPointer();
+        FileType* filePtr = (FileType*) dataPtr;
+        if( isCompressed && elements > 0 )
+            filePtr = new FileType[elements];
+
         ParallelDomainCollector* dataCollector = params->dataCollector;
         for (uint32_t d = 0; d < components; d++)
         {
@@ -88,7 +98,6 @@ struct LoadParticleAttributesFromHDF5
             if (components > 1)
                 datasetName << "/" << name_lookup[d];
 
-            ValueType* dataPtr = frame.getIdentifier(Identifier()).getPointer();
             Dimensions sizeRead(0, 0, 0);
             // read one component from file to temporary array
             dataCollector->read(params->currentStep,
@@ -104,12 +113,20 @@ struct LoadParticleAttributesFromHDF5
             #pragma omp parallel for
             for (size_t i = 0; i < elements; ++i)
             {
-                ComponentType& ref = ((ComponentType*) dataPtr)[i * components + d];
+                ComponentType& ref = ((ComponentType*) filePtr)[i * components + d];
                 ref = tmpArray[i];
             }
         }
         __deleteArray(tmpArray);
 
+        if( isCompressed && elements > 0 )
+        {
+            #pragma omp parallel for
+            for (size_t i = 0; i < elements; ++i)
+                dataPtr[i] = filePtr[i];
+            __deleteArray(filePtr);
+        }
+
         log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) load species attribute: %1%") %
             Identifier::getName();
     }
@@ -167,7 +167,8 @@ public:
              */
             GridBuffer<uint32_t, DIM1> counterBuffer(DataSpace<DIM1>(3));
 
-            const uint32_t cellsInSuperCell = PMacc::math::CT::volume<SuperCellSize>::type::value;
+            /* one thread per frame slot */
+            const uint32_t particlesPerFrame = FrameType::FrameSize::value;
 
             const uint32_t iterationsForLoad = ceil(double(totalNumParticles) / double(restartChunkSize));
             uint32_t leftOverParticles = totalNumParticles;
@@ -186,8 +187,8 @@ public:
                 __cudaKernel(
                     copySpeciesGlobal2Local,
                     alpaka::dim::DimInt<1>,
-                    ceil(double(currentChunkSize) / double(cellsInSuperCell)),
-                    cellsInSuperCell)(
+                    ceil(double(currentChunkSize) / double(particlesPerFrame)),
+                    particlesPerFrame)(
                         counterBuffer.getDeviceBuffer().getDataBox(),
                         speciesTmp->getDeviceParticlesBox(), deviceFrame,
                         (int) totalNumParticles,
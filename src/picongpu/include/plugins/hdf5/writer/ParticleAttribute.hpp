@@ -30,6 +30,7 @@
 #include "traits/GetComponentsType.hpp"
 #include "traits/GetNComponents.hpp"
 #include "traits/Resolve.hpp"
+#include "particles/attribute/CompressedAttributes.hpp"
 
 namespace picongpu
 {
@@ -67,8 +68,10 @@ struct ParticleAttribute
 
         typedef T_Identifier Identifier;
         typedef typename PMacc::traits::Resolve<Identifier>::type::type ValueType;
-        const uint32_t components = GetNComponents<ValueType>::value;
-        typedef typename GetComponentsType<ValueType>::type ComponentType;
+        /* compressed attributes are stored decoded in the file */
+        typedef typename attribute::DecodedType<ValueType>::type FileType;
+        const uint32_t components = GetNComponents<FileType>::value;
+        typedef typename GetComponentsType<FileType>::type ComponentType;
         typedef typename PICToSplash<ComponentType>::type SplashType;
 
         const ThreadParams *threadParams = params;
@@ -103,7 +106,7 @@ struct ParticleAttribute
             splashDomainSize[d] = threadParams->window.localDimensions.size[d];
         }
 
-        typedef typename GetComponentsType<ValueType>::type ComponentValueType;
+        typedef typename GetComponentsType<FileType>::type ComponentValueType;
 
         ComponentValueType* tmpArray = new ComponentValueType[elements];
 
@@ -118,7 +121,8 @@ struct ParticleAttribute
             #pragma omp parallel for
             for (size_t i = 0; i < elements; ++i)
             {
-                tmpArray[i] = ((ComponentValueType*)dataPtr)[i * components + d];
+                const FileType value(dataPtr[i]);
+                tmpArray[i] = ((const ComponentValueType*) &value)[d];
             }
 
             threadParams->dataCollector->writeDomain(threadParams->currentStep,
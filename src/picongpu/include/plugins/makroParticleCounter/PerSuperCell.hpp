@@ -68,6 +68,7 @@ ALPAKA_FN_ACC void operator()(
     const DataSpace<simDim> counterCell = block - mapper.getGuardingSuperCells();
 
     const int linearThreadIdx = DataSpaceOperations<simDim>::template map<SuperCellSize > (threadIndex);
+    const int cellsPerSuperCell = PMacc::math::CT::volume<SuperCellSize>::type::value;
 
     PMACC_AUTO(counterValue,alpaka::block::shared::allocVar<uint64_cu>(acc));
     PMACC_AUTO(frame,alpaka::block::shared::allocVar<FrameType *>(acc));
@@ -86,20 +87,25 @@ ALPAKA_FN_ACC void operator()(
     if (!isValid)
         return; //end kernel if we have no frames
 
-    bool isParticle = (*frame)[linearThreadIdx][multiMask_];
+    /* only the first visited (=last) frame can have gaps */
+    bool isLastFrame = true;
 
     while (isValid)
     {
-        if (isParticle)
+        /* a frame can hold more or less particles than cells in a supercell */
+        for (int particleIdx = linearThreadIdx; particleIdx < (int) FrameType::FrameSize::value; particleIdx += cellsPerSuperCell)
         {
-            alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &counterValue, static_cast<uint64_cu> (1LU));
+            if (!isLastFrame || (*frame)[particleIdx][multiMask_])
+            {
+                alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &counterValue, static_cast<uint64_cu> (1LU));
+            }
         }
         alpaka::block::sync::syncBlockThreads(acc);
         if (linearThreadIdx == 0)
         {
             frame = &(parBox.getPreviousFrame(*frame, isValid));
         }
-        isParticle = true;
+        isLastFrame = false;
         alpaka::block::sync::syncBlockThreads(acc);
     }
 
@@ -311,6 +311,7 @@ ALPAKA_FN_ACC void operator()(
 
 
     int localId = threadIndex.z() * Block::x::value * Block::y::value + threadIndex.y() * Block::x::value + threadIndex.x();
+    const int cellsPerSuperCell = PMacc::math::CT::volume<Block>::type::value;
 
 
     if (localId == 0)
@@ -363,19 +364,23 @@ ALPAKA_FN_ACC void operator()(
 
     while (isValid) //move over all Frames
     {
-        PMACC_AUTO(particle, (*frame)[localId]);
-        if (particle[multiMask_] == 1)
+        /* a frame can hold more or less particles than cells in a supercell */
+        for (int particleIdx = localId; particleIdx < (int) FRAME::FrameSize::value; particleIdx += cellsPerSuperCell)
         {
-            int cellIdx = particle[localCellIdx_];
-            // we only draw the first slice of cells in the super cell (z == 0)
-            const DataSpace<simDim> particleCellId(DataSpaceOperations<simDim>::template map<Block > (cellIdx));
+            PMACC_AUTO(particle, (*frame)[particleIdx]);
+            if (particle[multiMask_] == 1)
+            {
+                int cellIdx = particle[localCellIdx_];
+                // we only draw the first slice of cells in the super cell (z == 0)
+                const DataSpace<simDim> particleCellId(DataSpaceOperations<simDim>::template map<Block > (cellIdx));
 #if(SIMDIM==DIM3)
-            uint32_t globalParticleCell = particleCellId[sliceDim] + globalOffset + blockOffset[sliceDim];
-            if (globalParticleCell == slice)
+                uint32_t globalParticleCell = particleCellId[sliceDim] + globalOffset + blockOffset[sliceDim];
+                if (globalParticleCell == slice)
 #endif
-            {
-                const DataSpace<DIM2> reducedCell(particleCellId[transpose.x()], particleCellId[transpose.y()]);
-                alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &(counter(reducedCell)), particle[weighting_] / particles::TYPICAL_NUM_PARTICLES_PER_MACROPARTICLE);
+                {
+                    const DataSpace<DIM2> reducedCell(particleCellId[transpose.x()], particleCellId[transpose.y()]);
+                    alpaka::atomic::atomicOp<alpaka::atomic::op::Add>(acc, &(counter(reducedCell)), particle[weighting_] / particles::TYPICAL_NUM_PARTICLES_PER_MACROPARTICLE);
+                }
             }
         }
         alpaka::block::sync::syncBlockThreads(acc);
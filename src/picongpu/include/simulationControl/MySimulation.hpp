@@ -35,6 +35,7 @@
 #include "dimensions/GridLayout.hpp"
 #include "fields/LaserPhysics.hpp"
 #include "nvidia/memory/MemoryInfo.hpp"
+#include "memory/NumaPlacement.hpp"
 #include "mappings/kernel/MappingDescription.hpp"
 #include "simulationControl/MovingWindow.hpp"
 #include "mappings/simulation/SubGrid.hpp"
@@ -48,6 +49,7 @@
 #include "fields/MaxwellSolver/Solvers.hpp"
 #include "fields/currentInterpolation/CurrentInterpolation.hpp"
 #include "fields/background/cellwiseOperation.hpp"
+#include "fields/background/CachedBackground.hpp"
 #include "initialization/IInitPlugin.hpp"
 #include "initialization/ParserGridDistribution.hpp"
 
@@ -96,7 +98,9 @@ public:
     laser(NULL),
     initialiserController(NULL),
     cellDescription(NULL),
-    slidingWindow(false)
+    slidingWindow(false),
+    particleSortPeriod(0),
+    backgroundInFields(false)
     {
         ForEach<VectorAllSpecies, particles::AssignNull<bmpl::_1>, MakeIdentifier<bmpl::_1> > setPtrToNull;
         setPtrToNull(forward(particleStorage));
@@ -122,7 +126,10 @@ public:
             ("periodic", po::value<std::vector<uint32_t> > (&periodic)->multitoken(),
              "specifying whether the grid is periodic (1) or not (0) in each dimension, default: no periodic dimensions")
 
-            ("moving,m", po::value<bool>(&slidingWindow)->zero_tokens(), "enable sliding/moving window");
+            ("moving,m", po::value<bool>(&slidingWindow)->zero_tokens(), "enable sliding/moving window")
+
+            ("particleSortPeriod", po::value<uint32_t>(&particleSortPeriod)->default_value(0),
+             "sort particles of each supercell by cell and pack frames every N steps, 0 = disabled");
     }
 
     std::string pluginGetName() const
@@ -170,6 +177,12 @@ public:
             isPeriodic[i] = periodic[i];
         }
 
+        /* CPU buffers are first touched with the decomposition of the kernels */
+        DataSpace<DIM3> blockExtent(1, 1, 1);
+        for (uint32_t i = 0; i < simDim; ++i)
+            blockExtent[i] = MappingDesc::SuperCellSize::toRT()[i];
+        NumaPlacement::getInstance().setBlockExtent(blockExtent);
+
         Environment<simDim>::get().initDevices(gpus, isPeriodic);
 
         DataSpace<simDim> myGPUpos(Environment<simDim>::get().GridController().getPosition());
@@ -256,6 +269,8 @@ public:
         __delete(laser);
         __delete(pushBGField);
         __delete(currentBGField);
+        fieldBackground::BackgroundCache<FieldBackgroundE>::release();
+        fieldBackground::BackgroundCache<FieldBackgroundB>::release();
         __delete(cellDescription);
     }
 
@@ -280,6 +295,10 @@ public:
         ForEach<VectorAllSpecies, particles::CreateSpecies<bmpl::_1>, MakeIdentifier<bmpl::_1> > createSpeciesMemory;
         createSpeciesMemory(forward(particleStorage), cellDescription);
 
+        /* tables of background fields, before the heap takes the free memory */
+        fieldBackground::BackgroundCache<FieldBackgroundE>::allocate();
+        fieldBackground::BackgroundCache<FieldBackgroundB>::allocate();
+
         size_t freeGpuMem(0);
         Environment<>::get().EnvMemoryInfo().setReservedMemory(totalFreeGpuMemory);
         Environment<>::get().EnvMemoryInfo().getMemoryInfo(&freeGpuMem);
@@ -361,6 +380,7 @@ public:
         if( step != 0 )
         {
             namespace nvfct = PMacc::nvidia::functors;
+            updateBackgroundCache(step);
             (*pushBGField)( fieldE, nvfct::Sub(), FieldBackgroundE(fieldE->getUnit()),
                             step, FieldBackgroundE::InfluenceParticlePusher);
             (*pushBGField)( fieldB, nvfct::Sub(), FieldBackgroundB(fieldB->getUnit()),
@@ -390,34 +410,62 @@ public:
     {
         namespace nvfct = PMacc::nvidia::functors;
 
+#if (ENABLE_PUSHER_BACKGROUND_FIELDS == 1)
+        /* remove the background fields added for the plugins,
+         * the particle kernels add them while caching E and B */
+        if (backgroundInFields)
+        {
+            (*pushBGField)(fieldE, nvfct::Sub(), FieldBackgroundE(fieldE->getUnit()),
+                           currentStep, FieldBackgroundE::InfluenceParticlePusher);
+            (*pushBGField)(fieldB, nvfct::Sub(), FieldBackgroundB(fieldB->getUnit()),
+                           currentStep, FieldBackgroundB::InfluenceParticlePusher);
+            backgroundInFields = false;
+        }
+#endif
+
         /* Initialize ionization routine for each species
          *      - valid species will be ionized
          *      - invalid species (e.g. electrons): fallback */
         ForEach<VectorAllSpecies, particles::CallIonization<bmpl::_1>, MakeIdentifier<bmpl::_1> > particleIonization;
         particleIonization(forward(particleStorage), cellDescription, currentStep);
 
-        EventTask initEvent = __getTransactionEvent();
+#if (ENABLE_CURRENT == 1) && (ENABLE_FUSED_PUSH_CURRENT == 1)
+        /* the current is deposited during the push */
+        fieldJ->clear();
+#endif
+
+        EventTask pushEvent = __getTransactionEvent();
         EventTask updateEvent;
         EventTask commEvent;
 
-        ForEach<VectorAllSpecies, particles::CallUpdate<bmpl::_1>, MakeIdentifier<bmpl::_1> > particleUpdate;
-        particleUpdate(forward(particleStorage), currentStep, initEvent, forward(updateEvent), forward(commEvent));
+        /* each species is pushed, shifted and communicated on its own stream,
+         * all pushes are enqueued before the first shift waits for its push
+         * so that small species overlap with large ones */
+        ForEach<VectorAllSpecies, particles::CallPush<bmpl::_1>, MakeIdentifier<bmpl::_1> > particlePush;
+        particlePush(forward(particleStorage), currentStep, particleSortPeriod, forward(pushEvent));
+
+        ForEach<VectorAllSpecies, particles::CallShiftAndCommunicate<bmpl::_1>, MakeIdentifier<bmpl::_1> > particleShift;
+        particleShift(forward(particleStorage), currentStep, forward(updateEvent), forward(commEvent));
 
         __setTransactionEvent(updateEvent);
+#if (ENABLE_PUSHER_BACKGROUND_FIELDS != 1)
         /** remove background field for particle pusher */
         (*pushBGField)(fieldE, nvfct::Sub(), FieldBackgroundE(fieldE->getUnit()),
                        currentStep, FieldBackgroundE::InfluenceParticlePusher);
         (*pushBGField)(fieldB, nvfct::Sub(), FieldBackgroundB(fieldB->getUnit()),
                        currentStep, FieldBackgroundB::InfluenceParticlePusher);
+#endif
 
         this->myFieldSolver->update_beforeCurrent(currentStep);
 
+#if (ENABLE_CURRENT != 1) || (ENABLE_FUSED_PUSH_CURRENT != 1)
         fieldJ->clear();
+#endif
 
         __setTransactionEvent(commEvent);
         (*currentBGField)(fieldJ, nvfct::Add(), FieldBackgroundJ(fieldJ->getUnit()),
                           currentStep, FieldBackgroundJ::activated);
-#if (ENABLE_CURRENT == 1)
+#if (ENABLE_CURRENT == 1) && (ENABLE_FUSED_PUSH_CURRENT != 1)
         ForEach<VectorAllSpecies, ComputeCurrent<bmpl::_1,bmpl::int_<CORE + BORDER> >, MakeIdentifier<bmpl::_1> > computeCurrent;
         computeCurrent(forward(fieldJ),forward(particleStorage), currentStep);
 #endif
@@ -458,7 +506,14 @@ public:
 
     virtual void movingWindowCheck(uint32_t currentStep)
     {
-        if (MovingWindow::getInstance().slideInCurrentStep(currentStep))
+        const bool doSlide = MovingWindow::getInstance().slideInCurrentStep(currentStep);
+
+        /* the field solver may keep parts of the fields at other time levels
+         * between steps without output */
+        if (doSlide || isDumpStep(currentStep) || currentStep == this->runSteps)
+            this->myFieldSolver->synchronize(currentStep);
+
+        if (doSlide)
         {
             slide(currentStep);
         }
@@ -471,6 +526,16 @@ public:
          */
         namespace nvfct = PMacc::nvidia::functors;
 
+        updateBackgroundCache(currentStep);
+
+#if (ENABLE_PUSHER_BACKGROUND_FIELDS == 1)
+        /* the pusher does not need the background in E and B, it is only
+         * added for steps with plugin output or a checkpoint */
+        if (!isDumpStep(currentStep) || backgroundInFields)
+            return;
+        backgroundInFields = true;
+#endif
+
         (*pushBGField)( fieldE, nvfct::Add(), FieldBackgroundE(fieldE->getUnit()),
                         currentStep, FieldBackgroundE::InfluenceParticlePusher );
         (*pushBGField)( fieldB, nvfct::Add(), FieldBackgroundB(fieldB->getUnit()),
@@ -515,6 +580,23 @@ public:
 
 private:
 
+    /* true if plugins or a checkpoint use the fields of a step */
+    bool isDumpStep(uint32_t currentStep) const
+    {
+        return Environment<>::get().PluginConnector().hasNotifications(currentStep) ||
+            (this->checkpointPeriod && (currentStep % this->checkpointPeriod == 0));
+    }
+
+    /** prepare tabulated background fields for a step
+     *
+     * must be called before the background fields of the step are used
+     */
+    void updateBackgroundCache(uint32_t currentStep)
+    {
+        fieldBackground::BackgroundCache<FieldBackgroundE>::update(fieldE->getUnit(), currentStep);
+        fieldBackground::BackgroundCache<FieldBackgroundB>::update(fieldB->getUnit(), currentStep);
+    }
+
     template<uint32_t DIM>
     void checkGridConfiguration(DataSpace<DIM> globalGridSize, GridLayout<DIM>)
     {
@@ -617,6 +699,11 @@ protected:
     std::vector<std::string> gridDistribution;
 
     bool slidingWindow;
+    /* period of particle sorting, 0 disables sorting */
+    uint32_t particleSortPeriod;
+    /* E and B contain the background fields for the pusher
+     * (only used with ENABLE_PUSHER_BACKGROUND_FIELDS) */
+    bool backgroundInFields;
 };
 } /* namespace picongpu */
 
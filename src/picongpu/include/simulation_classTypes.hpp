@@ -25,6 +25,7 @@
 #include "simulation_defines.hpp"
 
 #include "mappings/kernel/AreaMapping.hpp"
+#include "mappings/threads/ElementMapping.hpp"
 #include "math/Vector.hpp"
 #include "eventSystem/EventSystem.hpp"
 #include "types.h"
@@ -58,6 +59,24 @@ namespace picongpu
         }
 #endif
 
+/**
+ * Same as PIC_KERNEL_PARAMS but also closes the scope of the emptiness
+ * check of __picKernelList.
+ *
+ * @param ... Parameters to pass to kernel
+ */
+#if BOOST_COMP_MSVC
+    #define PIC_KERNEL_LIST_PARAMS(...)\
+            ,__VA_ARGS__, mapper));\
+            PMACC_ACTIVATE_KERNEL();\
+        }}
+#else
+    #define PIC_KERNEL_LIST_PARAMS(...)\
+            ,##__VA_ARGS__, mapper));\
+            PMACC_ACTIVATE_KERNEL();\
+        }}
+#endif
+
 /**
  * Calls a CUDA kernel and creates an EventTask which represents the kernel.
  *
@@ -73,6 +92,7 @@ namespace picongpu
         typedef ::PMacc::AreaMapping<area, MappingDesc> UsedAreaMapper;              \
         UsedAreaMapper mapper(description);                                          \
         ::PMacc::TaskKernel * const taskKernel(::PMacc::Environment<>::get().Factory().createTaskKernel(#KERNEL));\
+        taskKernel->setArea(area);                                                   \
         auto const exec(::alpaka::exec::create<::PMacc::AlpakaAcc<DIM>>(             \
             ::alpaka::workdiv::WorkDivMembers<DIM, AlpakaIdxSize>(                   \
                 mapper.getGridDim(),                                                 \
@@ -80,3 +100,79 @@ namespace picongpu
                 ::PMacc::math::Vector<AlpakaIdxSize,UsedAreaMapper::Dim>::create(1u) \
             ), KERNEL                                                                \
         PIC_KERNEL_PARAMS
+
+/**
+ * Calls a kernel with one thread per cell of a supercell and creates an
+ * EventTask which represents the kernel.
+ *
+ * Same as __picKernelArea but the kernel is executed with
+ * AlpakaSuperCellAcc and must iterate over the elements given by
+ * ElementMapping.
+ *
+ * @param block number of cells per block
+ */
+#define __picKernelAreaSuperCell(KERNEL, DIM, description, area, block)\
+    {\
+        PMACC_KERNEL_CATCH(::alpaka::wait::wait(::PMacc::Environment<>::get().DeviceManager().getAccDevice()), "picKernelAreaSuperCell: crash before kernel call");\
+        typedef ::PMacc::AreaMapping<area, MappingDesc> UsedAreaMapper;              \
+        UsedAreaMapper mapper(description);                                          \
+        ::PMacc::TaskKernel * const taskKernel(::PMacc::Environment<>::get().Factory().createTaskKernel(#KERNEL));\
+        taskKernel->setArea(area);                                                   \
+        auto const exec(::alpaka::exec::create<::PMacc::AlpakaSuperCellAcc<DIM>>(    \
+            ::alpaka::workdiv::WorkDivMembers<DIM, AlpakaIdxSize>(                   \
+                mapper.getGridDim(),                                                 \
+                ::PMacc::ElementMapping::getThreadExtent(block),                     \
+                ::PMacc::ElementMapping::getElemExtent(block)                        \
+            ), KERNEL                                                                \
+        PIC_KERNEL_PARAMS
+
+/**
+ * Calls a kernel for each supercell of a ListMapping and creates an
+ * EventTask which represents the kernel.
+ *
+ * Same as __picKernelArea but the grid is given by the list, e.g.
+ * ActiveSuperCellList::getMapping(). Nothing is launched for an empty list,
+ * the check is part of the scope of the macro (safe in if/else branches).
+ * The list mapper is appended as last argument of the kernel call.
+ *
+ * @param listMapper ListMapping instance, must not be named `mapper`
+ * @param area area type of the supercells in the list (used for profiling)
+ */
+#define __picKernelList(KERNEL, DIM, listMapper, area, block)\
+    {\
+        auto const mapper(listMapper);                                               \
+        if (mapper.getSize() != 0u)                                                  \
+        {\
+        PMACC_KERNEL_CATCH(::alpaka::wait::wait(::PMacc::Environment<>::get().DeviceManager().getAccDevice()), "picKernelList: crash before kernel call");\
+        ::PMacc::TaskKernel * const taskKernel(::PMacc::Environment<>::get().Factory().createTaskKernel(#KERNEL));\
+        taskKernel->setArea(area);                                                   \
+        auto const exec(::alpaka::exec::create<::PMacc::AlpakaAcc<DIM>>(             \
+            ::alpaka::workdiv::WorkDivMembers<DIM, AlpakaIdxSize>(                   \
+                mapper.getGridDim(),                                                 \
+                block,                                                               \
+                ::PMacc::math::Vector<AlpakaIdxSize,DIM::value>::create(1u)          \
+            ), KERNEL                                                                \
+        PIC_KERNEL_LIST_PARAMS
+
+/**
+ * Same as __picKernelList but the kernel is executed with
+ * AlpakaSuperCellAcc and must iterate over the elements given by
+ * ElementMapping.
+ *
+ * @param block number of cells per block
+ */
+#define __picKernelListSuperCell(KERNEL, DIM, listMapper, area, block)\
+    {\
+        auto const mapper(listMapper);                                               \
+        if (mapper.getSize() != 0u)                                                  \
+        {\
+        PMACC_KERNEL_CATCH(::alpaka::wait::wait(::PMacc::Environment<>::get().DeviceManager().getAccDevice()), "picKernelListSuperCell: crash before kernel call");\
+        ::PMacc::TaskKernel * const taskKernel(::PMacc::Environment<>::get().Factory().createTaskKernel(#KERNEL));\
+        taskKernel->setArea(area);                                                   \
+        auto const exec(::alpaka::exec::create<::PMacc::AlpakaSuperCellAcc<DIM>>(    \
+            ::alpaka::workdiv::WorkDivMembers<DIM, AlpakaIdxSize>(                   \
+                mapper.getGridDim(),                                                 \
+                ::PMacc::ElementMapping::getThreadExtent(block),                     \
+                ::PMacc::ElementMapping::getElemExtent(block)                        \
+            ), KERNEL                                                                \
+        PIC_KERNEL_LIST_PARAMS
@@ -64,19 +64,27 @@ MALLOCMC_SET_ALLOCATOR_TYPE( ScatterAllocator );
 
 #else
 
+// configure the CreationPolicy "ThreadCache"
+struct ThreadCacheConfig
+{
+    /* 2MiB page can hold around 256 particle frames */
+    typedef boost::mpl::int_<2*1024*1024> pagesize;
+    /* free frames kept per thread before they are returned to the shared list */
+    typedef boost::mpl::int_<64> cachedslots;
+};
 
-// Define a new allocator and call it ScatterAllocator
-// which resembles the behavior of ScatterAlloc
-using AllocatorHostNew = mallocMC::Allocator<
-    mallocMC::CreationPolicies::HostNew,
+// Define a new allocator and call it ThreadCacheAllocator
+// which carves frames out of a pre-allocated host pool
+using ThreadCacheAllocator = mallocMC::Allocator<
+    mallocMC::CreationPolicies::ThreadCache<ThreadCacheConfig>,
     mallocMC::DistributionPolicies::Noop,
     mallocMC::OOMPolicies::ReturnNull,
-    mallocMC::ReservePoolPolicies::NoOp,
+    mallocMC::ReservePoolPolicies::HostMalloc,
     mallocMC::AlignmentPolicies::Noop
     >;
 
-//use AllocatorHostNew to replace malloc/free
-MALLOCMC_SET_ALLOCATOR_TYPE( AllocatorHostNew );
+//use ThreadCacheAllocator to replace malloc/free
+MALLOCMC_SET_ALLOCATOR_TYPE( ThreadCacheAllocator );
 
 #endif
 
@@ -41,3 +41,6 @@
 
 #include "creationPolicies/HostNew.hpp"
 #include "creationPolicies/HostNew_impl.hpp"
+
+#include "creationPolicies/ThreadCache.hpp"
+#include "creationPolicies/ThreadCache_impl.hpp"
@@ -32,6 +32,9 @@
 #include "reservePoolPolicies/NoOp.hpp"
 #include "reservePoolPolicies/NoOp_impl.hpp"
 
+#include "reservePoolPolicies/HostMalloc.hpp"
+#include "reservePoolPolicies/HostMalloc_impl.hpp"
+
 #if defined(MAMC_CUDA_ENABLED) && defined(__CUDACC__)
 
 #include "reservePoolPolicies/SimpleCudaMalloc.hpp"
@@ -0,0 +1,66 @@
+/*
+  mallocMC: Memory Allocator for Many Core Architectures.
+
+  Copyright 2026 agent
+
+  Author(s):  agent
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <boost/mpl/int.hpp>
+
+namespace mallocMC{
+namespace CreationPolicies{
+namespace ThreadCacheConf{
+  struct DefaultThreadCacheConfig{
+    /* size of the pages which are assigned to one slot size */
+    typedef boost::mpl::int_<2*1024*1024> pagesize;
+    /* maximal number of free slots per slot size in the cache of a thread */
+    typedef boost::mpl::int_<64>          cachedslots;
+  };
+}
+
+  /**
+   * @brief host memory allocation with thread local free lists
+   *
+   * This CreationPolicy carves fixed-size slots out of a pre-allocated pool
+   * on the host. The pool is divided into pages, each page serves a single
+   * slot size. Every thread keeps a free list per slot size, only if this
+   * list is empty or too long the shared lock-free free list of the slot
+   * size or the page counter is used. Memory freed by another thread is put
+   * into the cache of the freeing thread, thus no locks are needed.
+   * Pages are touched first by the thread which allocates from them.
+   *
+   * The policy reports free memory slots of a given size on the host and
+   * requires a ReservePoolPolicy which provides host memory (e.g.
+   * HostMalloc).
+   *
+   * @tparam T_Config (optional) configure the heap layout. The
+   *        default can be obtained through ThreadCache<>::HeapProperties
+   */
+  template<
+  class T_Config = ThreadCacheConf::DefaultThreadCacheConfig
+  >
+  class ThreadCache;
+
+}// namespace CreationPolicies
+}// namespace mallocMC
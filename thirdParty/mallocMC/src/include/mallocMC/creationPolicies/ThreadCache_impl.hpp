@@ -0,0 +1,356 @@
+/*
+  mallocMC: Memory Allocator for Many Core Architectures.
+
+  Copyright 2026 agent
+
+  Author(s):  agent
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ThreadCache.hpp"
+
+namespace mallocMC
+{
+namespace CreationPolicies
+{
+
+template<class T_Config>
+class ThreadCache
+{
+    typedef boost::uint8_t uint8;
+    typedef boost::uint32_t uint32;
+    typedef boost::uint64_t uint64;
+    typedef boost::int64_t int64;
+
+public:
+    typedef T_Config HeapProperties;
+    typedef boost::mpl::bool_<true> providesAvailableSlots;
+
+private:
+    static const size_t pagesize = T_Config::pagesize::value;
+    static const size_t cachedslots = T_Config::cachedslots::value;
+    /* slot sizes are multiples of the granularity, a slot is addressed by
+     * its offset in units of the granularity (32 bit) */
+    static const size_t granularity = 64;
+    static const uint32 maxSlotSizes = 16;
+
+    /* free slots of one thread */
+    struct LocalCache
+    {
+        const void* heap;
+        uint32 generation;
+        std::vector<uint32> slots[maxSlotSizes];
+
+        LocalCache() : heap(NULL), generation(0)
+        {
+        }
+    };
+
+    uint8* heapBegin;
+    size_t numPages;
+    /* slot size index of each claimed page */
+    uint8* pageSlotSize;
+    std::atomic<size_t> claimedPages;
+    /* registered slot sizes in byte, 0 is unused */
+    std::atomic<uint32> slotSizes[maxSlotSizes];
+    /* head of the shared free list per slot size: (tag << 32) | (unit + 1) */
+    std::atomic<uint64> freeLists[maxSlotSizes];
+    std::atomic<int64> usedSlots[maxSlotSizes];
+    /* changed by each initHeap and finalizeHeap to invalidate thread caches */
+    uint32 generation;
+
+    MAMC_HOST
+    static size_t roundSlotSize(size_t bytes)
+    {
+        return (bytes + granularity - 1) / granularity * granularity;
+    }
+
+    /* index of the slot size or -1 if the size is unknown (registerSize
+     * false) or all slot sizes are in use */
+    MAMC_HOST
+    int getSlotSizeIndex(size_t bytes, bool registerSize)
+    {
+        const uint32 rounded = static_cast<uint32>(roundSlotSize(bytes));
+        for(uint32 i = 0; i < maxSlotSizes; ++i)
+        {
+            uint32 current = slotSizes[i].load(std::memory_order_acquire);
+            if(current == 0 && registerSize)
+            {
+                slotSizes[i].compare_exchange_strong(current, rounded, std::memory_order_acq_rel);
+                if(current == 0)
+                    return i;
+            }
+            if(current == rounded)
+                return i;
+            if(current == 0)
+                return -1;
+        }
+        return -1;
+    }
+
+    MAMC_HOST
+    std::atomic<uint32>& nextOf(uint32 unit)
+    {
+        return *reinterpret_cast<std::atomic<uint32>*>(heapBegin + size_t(unit) * granularity);
+    }
+
+    MAMC_HOST
+    void pushShared(uint32 s, uint32 unit)
+    {
+        uint64 old = freeLists[s].load(std::memory_order_relaxed);
+        uint64 newHead;
+        do
+        {
+            nextOf(unit).store(static_cast<uint32>(old), std::memory_order_relaxed);
+            newHead = (((old >> 32) + 1) << 32) | (unit + 1);
+        }
+        while(!freeLists[s].compare_exchange_weak(old, newHead, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /* the tag in the upper 32 bit prevents the ABA problem, a slot is
+     * never unmapped thus reading the next index of a slot which was
+     * taken by another thread in the meantime is harmless */
+    MAMC_HOST
+    bool popShared(uint32 s, uint32& unit)
+    {
+        uint64 old = freeLists[s].load(std::memory_order_acquire);
+        while(static_cast<uint32>(old) != 0)
+        {
+            const uint32 top = static_cast<uint32>(old) - 1;
+            const uint32 next = nextOf(top).load(std::memory_order_relaxed);
+            const uint64 newHead = (((old >> 32) + 1) << 32) | next;
+            if(freeLists[s].compare_exchange_weak(old, newHead, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                unit = top;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /* fill an empty thread cache from the shared free list or a new page */
+    MAMC_HOST
+    bool refill(uint32 s, std::vector<uint32>& slots)
+    {
+        uint32 unit;
+        while(slots.size() < cachedslots / 2 && popShared(s, unit))
+            slots.push_back(unit);
+        if(!slots.empty())
+            return true;
+
+        const size_t page = claimedPages.fetch_add(1, std::memory_order_relaxed);
+        if(page >= numPages)
+            return false;
+        pageSlotSize[page] = static_cast<uint8>(s);
+
+        const size_t slotSize = slotSizes[s].load(std::memory_order_relaxed);
+        const size_t slotsPerPage = pagesize / slotSize;
+        const uint32 firstUnit = static_cast<uint32>(page * pagesize / granularity);
+        const uint32 unitsPerSlot = static_cast<uint32>(slotSize / granularity);
+        /* the cache is used from the back, thus low addresses are used first */
+        for(size_t i = slotsPerPage; i > 0; --i)
+        {
+            const uint32 slotUnit = firstUnit + static_cast<uint32>(i - 1) * unitsPerSlot;
+            if(i > cachedslots)
+                pushShared(s, slotUnit);
+            else
+                slots.push_back(slotUnit);
+        }
+        return true;
+    }
+
+    MAMC_HOST
+    LocalCache& getLocalCache()
+    {
+        static thread_local LocalCache cache;
+        if(cache.heap != this || cache.generation != generation)
+        {
+            for(uint32 i = 0; i < maxSlotSizes; ++i)
+                cache.slots[i].clear();
+            cache.heap = this;
+            cache.generation = generation;
+        }
+        return cache;
+    }
+
+    MAMC_HOST
+    void initPool(void* pool, size_t memsize)
+    {
+        const size_t maxUnits = size_t(UINT_MAX);
+        uint8* const begin = reinterpret_cast<uint8*>(pool);
+        const size_t skip = (granularity - reinterpret_cast<size_t>(begin) % granularity) % granularity;
+
+        heapBegin = NULL;
+        numPages = 0;
+        pageSlotSize = NULL;
+        if(pool != NULL && memsize > skip)
+        {
+            heapBegin = begin + skip;
+            numPages = std::min((memsize - skip) / pagesize, maxUnits / (pagesize / granularity));
+            pageSlotSize = new uint8[numPages];
+        }
+        claimedPages.store(0);
+        for(uint32 i = 0; i < maxSlotSizes; ++i)
+        {
+            slotSizes[i].store(0);
+            freeLists[i].store(0);
+            usedSlots[i].store(0);
+        }
+        ++generation;
+    }
+
+    MAMC_HOST
+    void finalizePool()
+    {
+        delete[] pageSlotSize;
+        pageSlotSize = NULL;
+        heapBegin = NULL;
+        numPages = 0;
+        ++generation;
+    }
+
+    MAMC_HOST
+    unsigned availableSlots(size_t slotSize)
+    {
+        if(heapBegin == NULL || slotSize == 0 || slotSize > pagesize)
+            return 0;
+
+        const size_t rounded = roundSlotSize(slotSize);
+        const size_t slotsPerPage = pagesize / rounded;
+        const size_t usedPages = std::min(claimedPages.load(), numPages);
+        size_t slots = (numPages - usedPages) * slotsPerPage;
+
+        const int s = getSlotSizeIndex(slotSize, false);
+        if(s >= 0)
+        {
+            size_t pagesOfSize = 0;
+            for(size_t page = 0; page < usedPages; ++page)
+                if(pageSlotSize[page] == s)
+                    ++pagesOfSize;
+            slots += pagesOfSize * slotsPerPage - static_cast<size_t>(usedSlots[s].load());
+        }
+        return static_cast<unsigned>(std::min(slots, size_t(UINT_MAX)));
+    }
+
+public:
+
+    ThreadCache() : heapBegin(NULL), numPages(0), pageSlotSize(NULL), generation(0)
+    {
+    }
+
+    MAMC_HOST
+    void* create(uint32 bytes)
+    {
+        if(heapBegin == NULL || bytes == 0 || bytes > pagesize)
+            return NULL;
+        const int s = getSlotSizeIndex(bytes, true);
+        if(s < 0)
+            return NULL;
+
+        std::vector<uint32>& slots = getLocalCache().slots[s];
+        if(slots.empty() && !refill(s, slots))
+            return NULL;
+        const uint32 unit = slots.back();
+        slots.pop_back();
+        usedSlots[s].fetch_add(1, std::memory_order_relaxed);
+        return reinterpret_cast<void*>(heapBegin + size_t(unit) * granularity);
+    }
+
+    MAMC_HOST
+    void destroy(void* mem)
+    {
+        if(mem == NULL)
+            return;
+        const size_t offset = size_t(reinterpret_cast<uint8*>(mem) - heapBegin);
+        const uint32 s = pageSlotSize[offset / pagesize];
+        usedSlots[s].fetch_sub(1, std::memory_order_relaxed);
+
+        /* the slot is cached by the freeing thread, also if it was
+         * allocated by another thread */
+        std::vector<uint32>& slots = getLocalCache().slots[s];
+        slots.push_back(static_cast<uint32>(offset / granularity));
+        if(slots.size() > cachedslots)
+        {
+            while(slots.size() > cachedslots / 2)
+            {
+                pushShared(s, slots.back());
+                slots.pop_back();
+            }
+        }
+    }
+
+    MAMC_HOST
+    bool isOOM( void* p, size_t s )
+    {
+        return s && (p == NULL);
+    }
+
+    template < typename T>
+    MAMC_HOST
+    static void* initHeap( const T& obj, void* pool, size_t memsize )
+    {
+        /* the heap is the global allocator object on the host */
+        ThreadCache& heap = const_cast<T&>(obj);
+        heap.initPool(pool, memsize);
+        return &heap;
+    }
+
+    template < typename T>
+    MAMC_HOST
+    static void finalizeHeap( const T& obj, void* pool )
+    {
+        ThreadCache& heap = const_cast<T&>(obj);
+        heap.finalizePool();
+    }
+
+    template < typename T_Obj >
+    MAMC_HOST
+    static unsigned getAvailableSlotsHost(size_t const slotSize, const T_Obj& obj)
+    {
+        ThreadCache& heap = const_cast<T_Obj&>(obj);
+        return heap.availableSlots(slotSize);
+    }
+
+    MAMC_HOST
+    static std::string classname( )
+    {
+        std::stringstream ss;
+        ss << "ThreadCache[";
+        ss << "pagesize=" << pagesize << ",";
+        ss << "cachedslots=" << cachedslots;
+        ss << "]";
+        return ss.str();
+    }
+
+};
+
+} //namespace CreationPolicies
+} //namespace mallocMC
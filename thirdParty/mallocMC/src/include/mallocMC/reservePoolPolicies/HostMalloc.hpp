@@ -0,0 +1,42 @@
+/*
+  mallocMC: Memory Allocator for Many Core Architectures.
+
+  Copyright 2026 agent
+
+  Author(s):  agent
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+*/
+
+#pragma once
+
+namespace mallocMC{
+namespace ReservePoolPolicies{
+
+  /**
+   * @brief Reserves the pool with the host malloc.
+   *
+   * This ReservePoolPolicy is intended for CreationPolicies which work on a
+   * host memory pool (e.g. ThreadCache). The memory is not touched, thus
+   * the operating system maps a page not before its first use.
+   */
+  struct HostMalloc;
+
+} //namespace ReservePoolPolicies
+} //namespace mallocMC